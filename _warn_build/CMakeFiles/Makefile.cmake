@@ -0,0 +1,126 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/benchmarks/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "benchmarks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/nodec.dir/DependInfo.cmake"
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__array_view.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__containers__paged_sparse_array.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__containers__paged_vector.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__containers__sparse_table.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__delegate.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__entitites__archetype_registry.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__entitites__command_buffer.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__entitites__group.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__entitites__hierarchy.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__entitites__registry.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__entitites__scheduler.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__entitites__signature.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__entitites__snapshot.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__entitites__storage.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__entitites__view.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__asyncio__event_loop.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__asyncio__event_promise.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__flags.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__string_builder__basic_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__string_builder__benchmark_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__string_builder__oss_compat_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__gfx.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__logging__logger_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__logging__bench_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__logging__simple_formatter_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__math.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__matrix4x4.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__observers.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__optional__basic.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__quaternion.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__random.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__ranges.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__resource_management__resource_registry.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__signals__concurrent_signal.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__signals__dispatcher.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__signals__signal.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__stopwatch.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__type_info.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__unicode.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__utility.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodec__vector.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/nodec_benchmarks.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec.dir/src/nodec/unicode.cpp.o"
+  "CMakeFiles/nodec.dir/src/nodec/unicode.cpp.o.d"
+  "libnodec.a"
+  "libnodec.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
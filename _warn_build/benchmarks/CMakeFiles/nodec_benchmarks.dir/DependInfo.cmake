@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/benchmarks/containers.cpp" "benchmarks/CMakeFiles/nodec_benchmarks.dir/containers.cpp.o" "gcc" "benchmarks/CMakeFiles/nodec_benchmarks.dir/containers.cpp.o.d"
+  "/root/repo/benchmarks/entities.cpp" "benchmarks/CMakeFiles/nodec_benchmarks.dir/entities.cpp.o" "gcc" "benchmarks/CMakeFiles/nodec_benchmarks.dir/entities.cpp.o.d"
+  "/root/repo/benchmarks/main.cpp" "benchmarks/CMakeFiles/nodec_benchmarks.dir/main.cpp.o" "gcc" "benchmarks/CMakeFiles/nodec_benchmarks.dir/main.cpp.o.d"
+  "/root/repo/benchmarks/signals.cpp" "benchmarks/CMakeFiles/nodec_benchmarks.dir/signals.cpp.o" "gcc" "benchmarks/CMakeFiles/nodec_benchmarks.dir/signals.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/CMakeFiles/nodec.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
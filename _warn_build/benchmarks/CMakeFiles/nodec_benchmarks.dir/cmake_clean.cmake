@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec_benchmarks.dir/containers.cpp.o"
+  "CMakeFiles/nodec_benchmarks.dir/containers.cpp.o.d"
+  "CMakeFiles/nodec_benchmarks.dir/entities.cpp.o"
+  "CMakeFiles/nodec_benchmarks.dir/entities.cpp.o.d"
+  "CMakeFiles/nodec_benchmarks.dir/main.cpp.o"
+  "CMakeFiles/nodec_benchmarks.dir/main.cpp.o.d"
+  "CMakeFiles/nodec_benchmarks.dir/signals.cpp.o"
+  "CMakeFiles/nodec_benchmarks.dir/signals.cpp.o.d"
+  "nodec_benchmarks"
+  "nodec_benchmarks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec_benchmarks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/benchmarks
+# Build directory: /root/repo/_warn_build/benchmarks
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(nodec_benchmarks__smoke "/root/repo/_warn_build/benchmarks/nodec_benchmarks" "--max-entities" "10000" "--min-time" "0")
+set_tests_properties(nodec_benchmarks__smoke PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/benchmarks/CMakeLists.txt;13;add_test;/root/repo/benchmarks/CMakeLists.txt;0;")
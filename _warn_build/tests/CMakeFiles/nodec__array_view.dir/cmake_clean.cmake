@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__array_view.dir/array_view/array_view.cpp.o"
+  "CMakeFiles/nodec__array_view.dir/array_view/array_view.cpp.o.d"
+  "nodec__array_view"
+  "nodec__array_view.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__array_view.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
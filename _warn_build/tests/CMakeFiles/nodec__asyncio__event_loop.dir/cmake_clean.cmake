@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__asyncio__event_loop.dir/asyncio/event_loop.cpp.o"
+  "CMakeFiles/nodec__asyncio__event_loop.dir/asyncio/event_loop.cpp.o.d"
+  "nodec__asyncio__event_loop"
+  "nodec__asyncio__event_loop.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__asyncio__event_loop.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__asyncio__event_promise.dir/asyncio/event_promise.cpp.o"
+  "CMakeFiles/nodec__asyncio__event_promise.dir/asyncio/event_promise.cpp.o.d"
+  "nodec__asyncio__event_promise"
+  "nodec__asyncio__event_promise.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__asyncio__event_promise.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__containers__paged_sparse_array.dir/containers/paged_sparse_array.cpp.o"
+  "CMakeFiles/nodec__containers__paged_sparse_array.dir/containers/paged_sparse_array.cpp.o.d"
+  "nodec__containers__paged_sparse_array"
+  "nodec__containers__paged_sparse_array.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__containers__paged_sparse_array.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
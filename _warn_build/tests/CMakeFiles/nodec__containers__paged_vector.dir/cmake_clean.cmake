@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__containers__paged_vector.dir/containers/paged_vector.cpp.o"
+  "CMakeFiles/nodec__containers__paged_vector.dir/containers/paged_vector.cpp.o.d"
+  "nodec__containers__paged_vector"
+  "nodec__containers__paged_vector.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__containers__paged_vector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
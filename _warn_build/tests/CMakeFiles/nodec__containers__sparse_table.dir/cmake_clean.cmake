@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__containers__sparse_table.dir/containers/sparse_table.cpp.o"
+  "CMakeFiles/nodec__containers__sparse_table.dir/containers/sparse_table.cpp.o.d"
+  "nodec__containers__sparse_table"
+  "nodec__containers__sparse_table.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__containers__sparse_table.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
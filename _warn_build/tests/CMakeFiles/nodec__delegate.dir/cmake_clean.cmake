@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__delegate.dir/delegate/delegate.cpp.o"
+  "CMakeFiles/nodec__delegate.dir/delegate/delegate.cpp.o.d"
+  "nodec__delegate"
+  "nodec__delegate.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__delegate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
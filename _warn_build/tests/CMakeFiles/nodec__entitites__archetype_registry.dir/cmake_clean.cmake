@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__entitites__archetype_registry.dir/entities/archetype_registry.cpp.o"
+  "CMakeFiles/nodec__entitites__archetype_registry.dir/entities/archetype_registry.cpp.o.d"
+  "nodec__entitites__archetype_registry"
+  "nodec__entitites__archetype_registry.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__entitites__archetype_registry.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
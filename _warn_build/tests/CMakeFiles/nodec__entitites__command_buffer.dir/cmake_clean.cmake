@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__entitites__command_buffer.dir/entities/command_buffer.cpp.o"
+  "CMakeFiles/nodec__entitites__command_buffer.dir/entities/command_buffer.cpp.o.d"
+  "nodec__entitites__command_buffer"
+  "nodec__entitites__command_buffer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__entitites__command_buffer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__entitites__group.dir/entities/group.cpp.o"
+  "CMakeFiles/nodec__entitites__group.dir/entities/group.cpp.o.d"
+  "nodec__entitites__group"
+  "nodec__entitites__group.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__entitites__group.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
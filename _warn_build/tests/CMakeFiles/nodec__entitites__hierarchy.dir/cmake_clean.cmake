@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__entitites__hierarchy.dir/entities/hierarchy.cpp.o"
+  "CMakeFiles/nodec__entitites__hierarchy.dir/entities/hierarchy.cpp.o.d"
+  "nodec__entitites__hierarchy"
+  "nodec__entitites__hierarchy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__entitites__hierarchy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
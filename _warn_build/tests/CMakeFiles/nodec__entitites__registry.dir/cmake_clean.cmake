@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__entitites__registry.dir/entities/registry.cpp.o"
+  "CMakeFiles/nodec__entitites__registry.dir/entities/registry.cpp.o.d"
+  "nodec__entitites__registry"
+  "nodec__entitites__registry.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__entitites__registry.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__entitites__scheduler.dir/entities/scheduler.cpp.o"
+  "CMakeFiles/nodec__entitites__scheduler.dir/entities/scheduler.cpp.o.d"
+  "nodec__entitites__scheduler"
+  "nodec__entitites__scheduler.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__entitites__scheduler.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
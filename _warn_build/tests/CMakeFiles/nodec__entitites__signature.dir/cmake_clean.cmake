@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__entitites__signature.dir/entities/signature.cpp.o"
+  "CMakeFiles/nodec__entitites__signature.dir/entities/signature.cpp.o.d"
+  "nodec__entitites__signature"
+  "nodec__entitites__signature.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__entitites__signature.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__entitites__snapshot.dir/entities/snapshot.cpp.o"
+  "CMakeFiles/nodec__entitites__snapshot.dir/entities/snapshot.cpp.o.d"
+  "nodec__entitites__snapshot"
+  "nodec__entitites__snapshot.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__entitites__snapshot.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
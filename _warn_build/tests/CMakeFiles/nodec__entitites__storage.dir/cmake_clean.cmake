@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__entitites__storage.dir/entities/storage.cpp.o"
+  "CMakeFiles/nodec__entitites__storage.dir/entities/storage.cpp.o.d"
+  "nodec__entitites__storage"
+  "nodec__entitites__storage.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__entitites__storage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__entitites__view.dir/entities/view.cpp.o"
+  "CMakeFiles/nodec__entitites__view.dir/entities/view.cpp.o.d"
+  "nodec__entitites__view"
+  "nodec__entitites__view.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__entitites__view.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__flags.dir/flags/flags.cpp.o"
+  "CMakeFiles/nodec__flags.dir/flags/flags.cpp.o.d"
+  "nodec__flags"
+  "nodec__flags.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__flags.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__gfx.dir/gfx/gfx.cpp.o"
+  "CMakeFiles/nodec__gfx.dir/gfx/gfx.cpp.o.d"
+  "nodec__gfx"
+  "nodec__gfx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__gfx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__logging__logger_test.dir/logging/logger_test.cpp.o"
+  "CMakeFiles/nodec__logging__logger_test.dir/logging/logger_test.cpp.o.d"
+  "nodec__logging__logger_test"
+  "nodec__logging__logger_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__logging__logger_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__math.dir/math/math.cpp.o"
+  "CMakeFiles/nodec__math.dir/math/math.cpp.o.d"
+  "nodec__math"
+  "nodec__math.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__math.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__matrix4x4.dir/matrix4x4/matrix4x4.cpp.o"
+  "CMakeFiles/nodec__matrix4x4.dir/matrix4x4/matrix4x4.cpp.o.d"
+  "nodec__matrix4x4"
+  "nodec__matrix4x4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__matrix4x4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__observers.dir/observers/observers.cpp.o"
+  "CMakeFiles/nodec__observers.dir/observers/observers.cpp.o.d"
+  "nodec__observers"
+  "nodec__observers.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__observers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__optional__basic.dir/optional/basic.cpp.o"
+  "CMakeFiles/nodec__optional__basic.dir/optional/basic.cpp.o.d"
+  "nodec__optional__basic"
+  "nodec__optional__basic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__optional__basic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
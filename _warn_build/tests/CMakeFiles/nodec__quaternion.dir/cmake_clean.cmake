@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__quaternion.dir/quaternion/quaternion.cpp.o"
+  "CMakeFiles/nodec__quaternion.dir/quaternion/quaternion.cpp.o.d"
+  "nodec__quaternion"
+  "nodec__quaternion.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__quaternion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
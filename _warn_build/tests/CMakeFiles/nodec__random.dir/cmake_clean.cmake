@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__random.dir/random/random.cpp.o"
+  "CMakeFiles/nodec__random.dir/random/random.cpp.o.d"
+  "nodec__random"
+  "nodec__random.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__random.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
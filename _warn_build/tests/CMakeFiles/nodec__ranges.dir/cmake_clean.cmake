@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__ranges.dir/ranges/ranges.cpp.o"
+  "CMakeFiles/nodec__ranges.dir/ranges/ranges.cpp.o.d"
+  "nodec__ranges"
+  "nodec__ranges.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__ranges.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
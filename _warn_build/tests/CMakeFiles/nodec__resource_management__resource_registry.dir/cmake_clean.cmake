@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__resource_management__resource_registry.dir/resource_management/resource_registry.cpp.o"
+  "CMakeFiles/nodec__resource_management__resource_registry.dir/resource_management/resource_registry.cpp.o.d"
+  "nodec__resource_management__resource_registry"
+  "nodec__resource_management__resource_registry.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__resource_management__resource_registry.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
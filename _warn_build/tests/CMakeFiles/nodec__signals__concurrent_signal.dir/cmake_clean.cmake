@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__signals__concurrent_signal.dir/signals/concurrent_signal.cpp.o"
+  "CMakeFiles/nodec__signals__concurrent_signal.dir/signals/concurrent_signal.cpp.o.d"
+  "nodec__signals__concurrent_signal"
+  "nodec__signals__concurrent_signal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__signals__concurrent_signal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__signals__dispatcher.dir/signals/dispatcher.cpp.o"
+  "CMakeFiles/nodec__signals__dispatcher.dir/signals/dispatcher.cpp.o.d"
+  "nodec__signals__dispatcher"
+  "nodec__signals__dispatcher.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__signals__dispatcher.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
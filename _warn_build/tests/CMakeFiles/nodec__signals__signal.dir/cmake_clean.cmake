@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__signals__signal.dir/signals/signal.cpp.o"
+  "CMakeFiles/nodec__signals__signal.dir/signals/signal.cpp.o.d"
+  "nodec__signals__signal"
+  "nodec__signals__signal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__signals__signal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
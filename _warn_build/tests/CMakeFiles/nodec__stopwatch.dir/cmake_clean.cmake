@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__stopwatch.dir/stopwatch/stopwatch.cpp.o"
+  "CMakeFiles/nodec__stopwatch.dir/stopwatch/stopwatch.cpp.o.d"
+  "nodec__stopwatch"
+  "nodec__stopwatch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__stopwatch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
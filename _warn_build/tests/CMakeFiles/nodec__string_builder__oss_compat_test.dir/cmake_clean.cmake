@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__string_builder__oss_compat_test.dir/string_builder/oss_compat_test.cpp.o"
+  "CMakeFiles/nodec__string_builder__oss_compat_test.dir/string_builder/oss_compat_test.cpp.o.d"
+  "nodec__string_builder__oss_compat_test"
+  "nodec__string_builder__oss_compat_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__string_builder__oss_compat_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
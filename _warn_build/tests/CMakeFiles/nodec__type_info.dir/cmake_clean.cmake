@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__type_info.dir/type_info/type_info.cpp.o"
+  "CMakeFiles/nodec__type_info.dir/type_info/type_info.cpp.o.d"
+  "nodec__type_info"
+  "nodec__type_info.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__type_info.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
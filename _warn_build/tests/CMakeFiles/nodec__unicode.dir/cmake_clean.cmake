@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__unicode.dir/unicode/unicode.cpp.o"
+  "CMakeFiles/nodec__unicode.dir/unicode/unicode.cpp.o.d"
+  "nodec__unicode"
+  "nodec__unicode.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__unicode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
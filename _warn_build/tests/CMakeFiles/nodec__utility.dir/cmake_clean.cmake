@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__utility.dir/utility/utility.cpp.o"
+  "CMakeFiles/nodec__utility.dir/utility/utility.cpp.o.d"
+  "nodec__utility"
+  "nodec__utility.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__utility.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodec__vector.dir/vector/vector.cpp.o"
+  "CMakeFiles/nodec__vector.dir/vector/vector.cpp.o.d"
+  "nodec__vector"
+  "nodec__vector.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodec__vector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
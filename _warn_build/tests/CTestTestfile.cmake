@@ -0,0 +1,88 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_warn_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(nodec__array_view "/root/repo/_warn_build/tests/nodec__array_view")
+set_tests_properties(nodec__array_view PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;11;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__containers__paged_sparse_array "/root/repo/_warn_build/tests/nodec__containers__paged_sparse_array")
+set_tests_properties(nodec__containers__paged_sparse_array PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;12;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__containers__paged_vector "/root/repo/_warn_build/tests/nodec__containers__paged_vector")
+set_tests_properties(nodec__containers__paged_vector PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;13;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__containers__sparse_table "/root/repo/_warn_build/tests/nodec__containers__sparse_table")
+set_tests_properties(nodec__containers__sparse_table PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;14;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__delegate "/root/repo/_warn_build/tests/nodec__delegate")
+set_tests_properties(nodec__delegate PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;15;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__entitites__archetype_registry "/root/repo/_warn_build/tests/nodec__entitites__archetype_registry")
+set_tests_properties(nodec__entitites__archetype_registry PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;16;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__entitites__command_buffer "/root/repo/_warn_build/tests/nodec__entitites__command_buffer")
+set_tests_properties(nodec__entitites__command_buffer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;17;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__entitites__group "/root/repo/_warn_build/tests/nodec__entitites__group")
+set_tests_properties(nodec__entitites__group PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;18;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__entitites__hierarchy "/root/repo/_warn_build/tests/nodec__entitites__hierarchy")
+set_tests_properties(nodec__entitites__hierarchy PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;19;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__entitites__registry "/root/repo/_warn_build/tests/nodec__entitites__registry")
+set_tests_properties(nodec__entitites__registry PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;20;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__entitites__scheduler "/root/repo/_warn_build/tests/nodec__entitites__scheduler")
+set_tests_properties(nodec__entitites__scheduler PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;21;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__entitites__signature "/root/repo/_warn_build/tests/nodec__entitites__signature")
+set_tests_properties(nodec__entitites__signature PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;22;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__entitites__snapshot "/root/repo/_warn_build/tests/nodec__entitites__snapshot")
+set_tests_properties(nodec__entitites__snapshot PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;23;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__entitites__storage "/root/repo/_warn_build/tests/nodec__entitites__storage")
+set_tests_properties(nodec__entitites__storage PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;24;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__entitites__view "/root/repo/_warn_build/tests/nodec__entitites__view")
+set_tests_properties(nodec__entitites__view PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;25;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__asyncio__event_loop "/root/repo/_warn_build/tests/nodec__asyncio__event_loop")
+set_tests_properties(nodec__asyncio__event_loop PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;26;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__asyncio__event_promise "/root/repo/_warn_build/tests/nodec__asyncio__event_promise")
+set_tests_properties(nodec__asyncio__event_promise PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;27;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__flags "/root/repo/_warn_build/tests/nodec__flags")
+set_tests_properties(nodec__flags PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;28;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__string_builder__basic_test "/root/repo/_warn_build/tests/nodec__string_builder__basic_test")
+set_tests_properties(nodec__string_builder__basic_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;30;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__string_builder__benchmark_test "/root/repo/_warn_build/tests/nodec__string_builder__benchmark_test")
+set_tests_properties(nodec__string_builder__benchmark_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;31;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__string_builder__oss_compat_test "/root/repo/_warn_build/tests/nodec__string_builder__oss_compat_test")
+set_tests_properties(nodec__string_builder__oss_compat_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;32;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__gfx "/root/repo/_warn_build/tests/nodec__gfx")
+set_tests_properties(nodec__gfx PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;34;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__logging__logger_test "/root/repo/_warn_build/tests/nodec__logging__logger_test")
+set_tests_properties(nodec__logging__logger_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;36;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__logging__bench_test "/root/repo/_warn_build/tests/nodec__logging__bench_test")
+set_tests_properties(nodec__logging__bench_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;37;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__logging__simple_formatter_test "/root/repo/_warn_build/tests/nodec__logging__simple_formatter_test")
+set_tests_properties(nodec__logging__simple_formatter_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;38;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__math "/root/repo/_warn_build/tests/nodec__math")
+set_tests_properties(nodec__math PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;40;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__matrix4x4 "/root/repo/_warn_build/tests/nodec__matrix4x4")
+set_tests_properties(nodec__matrix4x4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;41;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__observers "/root/repo/_warn_build/tests/nodec__observers")
+set_tests_properties(nodec__observers PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;42;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__optional__basic "/root/repo/_warn_build/tests/nodec__optional__basic")
+set_tests_properties(nodec__optional__basic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;43;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__quaternion "/root/repo/_warn_build/tests/nodec__quaternion")
+set_tests_properties(nodec__quaternion PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;44;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__random "/root/repo/_warn_build/tests/nodec__random")
+set_tests_properties(nodec__random PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;45;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__ranges "/root/repo/_warn_build/tests/nodec__ranges")
+set_tests_properties(nodec__ranges PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;46;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__resource_management__resource_registry "/root/repo/_warn_build/tests/nodec__resource_management__resource_registry")
+set_tests_properties(nodec__resource_management__resource_registry PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;47;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__signals__concurrent_signal "/root/repo/_warn_build/tests/nodec__signals__concurrent_signal")
+set_tests_properties(nodec__signals__concurrent_signal PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;48;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__signals__dispatcher "/root/repo/_warn_build/tests/nodec__signals__dispatcher")
+set_tests_properties(nodec__signals__dispatcher PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;49;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__signals__signal "/root/repo/_warn_build/tests/nodec__signals__signal")
+set_tests_properties(nodec__signals__signal PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;50;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__stopwatch "/root/repo/_warn_build/tests/nodec__stopwatch")
+set_tests_properties(nodec__stopwatch PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;51;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__type_info "/root/repo/_warn_build/tests/nodec__type_info")
+set_tests_properties(nodec__type_info PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;52;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__unicode "/root/repo/_warn_build/tests/nodec__unicode")
+set_tests_properties(nodec__unicode PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;53;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__utility "/root/repo/_warn_build/tests/nodec__utility")
+set_tests_properties(nodec__utility PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;54;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodec__vector "/root/repo/_warn_build/tests/nodec__vector")
+set_tests_properties(nodec__vector PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;8;add_test;/root/repo/tests/CMakeLists.txt;55;add_basic_test;/root/repo/tests/CMakeLists.txt;0;")
@@ -0,0 +1,138 @@
+#ifndef NODEC_BENCHMARKS__BENCHMARK_HPP_
+#define NODEC_BENCHMARKS__BENCHMARK_HPP_
+
+#include <nodec/stopwatch.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace nodec_benchmarks {
+
+/**
+ * @brief The measurement of a benchmark on an entity count.
+ */
+struct Result {
+    std::string name;
+    std::size_t entity_count{0};
+
+    //! The number of the measured operations, over all the repetitions.
+    std::size_t operations{0};
+    std::size_t repetitions{0};
+    double seconds{0.0};
+
+    //! The memory the benchmark reported, like BasicRegistry::memory_stats().total_bytes().
+    std::size_t memory_bytes{0};
+
+    double ops_per_second() const noexcept {
+        return seconds > 0.0 ? static_cast<double>(operations) / seconds : 0.0;
+    }
+
+    double ns_per_op() const noexcept {
+        return operations > 0 ? seconds * 1e9 / static_cast<double>(operations) : 0.0;
+    }
+};
+
+/**
+ * @brief The state handed to a benchmark function.
+ *
+ * The function prepares its data for entity_count(), then calls measure() with
+ * the timed part. The timed part is repeated until the minimum time passes, so
+ * it must leave the data as it found it.
+ */
+class State {
+public:
+    State(std::string name, std::size_t entity_count, std::chrono::duration<double> min_time)
+        : min_time_{min_time} {
+        result_.name = std::move(name);
+        result_.entity_count = entity_count;
+    }
+
+    std::size_t entity_count() const noexcept {
+        return result_.entity_count;
+    }
+
+    /**
+     * @brief Times the function, repeated until the minimum time passes. It runs once at least.
+     *
+     * @param operations The number of the operations a call of the function does.
+     * @param func void()
+     */
+    template<typename Func>
+    void measure(std::size_t operations, Func func) {
+        nodec::Stopwatch sw;
+        do {
+            sw.start();
+            func();
+            sw.stop();
+            result_.operations += operations;
+            ++result_.repetitions;
+        } while (sw.elapsed<double>() < min_time_);
+
+        result_.seconds += sw.elapsed<double>().count();
+    }
+
+    void set_memory_bytes(std::size_t bytes) noexcept {
+        result_.memory_bytes = bytes;
+    }
+
+    const Result &result() const noexcept {
+        return result_;
+    }
+
+private:
+    std::chrono::duration<double> min_time_;
+    Result result_;
+};
+
+/**
+ * @brief Lets the value escape, so the computation of it is not optimized away.
+ */
+template<typename T>
+void do_not_optimize_away(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    // Reads a byte of the value through a volatile pointer.
+    static_cast<void>(*reinterpret_cast<const volatile char *>(&value));
+#endif
+}
+
+struct Benchmark {
+    std::string name;
+    std::vector<std::size_t> entity_counts;
+    void (*func)(State &);
+};
+
+inline std::vector<Benchmark> &benchmarks() {
+    static std::vector<Benchmark> instance;
+    return instance;
+}
+
+struct Registrar {
+    Registrar(std::string name, std::vector<std::size_t> entity_counts, void (*func)(State &)) {
+        benchmarks().push_back({std::move(name), std::move(entity_counts), func});
+    }
+};
+
+//! The entity counts most of the benchmarks run on.
+#define NODEC_BENCHMARK_ALL_COUNTS 10'000, 100'000, 1'000'000, 10'000'000
+
+/**
+ * @brief Defines a benchmark run on each of the given entity counts.
+ *
+ * @code{.cpp}
+ * NODEC_BENCHMARK(create_destroy, "entities/create_destroy", NODEC_BENCHMARK_ALL_COUNTS) {
+ *     state.measure(state.entity_count(), [&]() { ... });
+ * }
+ * @endcode
+ */
+#define NODEC_BENCHMARK(func, name, ...)                                                                 \
+    static void func(::nodec_benchmarks::State &);                                                       \
+    static const ::nodec_benchmarks::Registrar func##_registrar{name, std::vector<std::size_t>{__VA_ARGS__}, &func}; \
+    static void func(::nodec_benchmarks::State &state)
+
+} // namespace nodec_benchmarks
+
+#endif
@@ -0,0 +1,97 @@
+#include "benchmark.hpp"
+
+#include <nodec/containers/paged_sparse_array.hpp>
+#include <nodec/containers/sparse_table.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace {
+
+using nodec::containers::PagedSparseArray;
+using nodec::containers::SparseTable;
+
+/**
+ * @brief The keys of the elements, one every stride, in a shuffled order.
+ */
+std::vector<std::size_t> make_keys(std::size_t count, std::size_t stride) {
+    std::vector<std::size_t> keys(count);
+    for (std::size_t i = 0; i < count; ++i) keys[i] = i * stride;
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(7));
+    return keys;
+}
+
+// The entity count is the number of the elements.
+
+template<typename Table>
+void bench_insert(nodec_benchmarks::State &state, std::size_t stride) {
+    const auto keys = make_keys(state.entity_count(), stride);
+
+    std::size_t memory = 0;
+    state.measure(keys.size(), [&]() {
+        Table table;
+        for (const auto key : keys) {
+            table[key] = key;
+        }
+        memory = table.memory_usage();
+    });
+    state.set_memory_bytes(memory);
+}
+
+template<typename Table>
+void bench_lookup(nodec_benchmarks::State &state, std::size_t stride) {
+    Table table;
+    for (const auto key : make_keys(state.entity_count(), stride)) {
+        table[key] = key;
+    }
+
+    // Every key in the range is looked up, the missing ones too.
+    std::vector<std::size_t> lookups(state.entity_count() * stride);
+    std::iota(lookups.begin(), lookups.end(), std::size_t{0});
+    std::shuffle(lookups.begin(), lookups.end(), std::mt19937(42));
+
+    std::size_t sum = 0;
+    state.measure(lookups.size(), [&]() {
+        for (const auto key : lookups) {
+            if (const auto *value = table.try_get(key)) sum += *value;
+        }
+    });
+    nodec_benchmarks::do_not_optimize_away(sum);
+    state.set_memory_bytes(table.memory_usage());
+}
+
+} // namespace
+
+NODEC_BENCHMARK(insert_dense_paged, "containers/sparse/insert/dense/paged_sparse_array", 10'000, 100'000, 1'000'000) {
+    bench_insert<PagedSparseArray<std::size_t>>(state, 1);
+}
+
+NODEC_BENCHMARK(insert_dense_table, "containers/sparse/insert/dense/sparse_table", 10'000, 100'000, 1'000'000) {
+    bench_insert<SparseTable<std::size_t>>(state, 1);
+}
+
+NODEC_BENCHMARK(insert_sparse_paged, "containers/sparse/insert/1_in_16/paged_sparse_array", 10'000, 100'000) {
+    bench_insert<PagedSparseArray<std::size_t>>(state, 16);
+}
+
+NODEC_BENCHMARK(insert_sparse_table, "containers/sparse/insert/1_in_16/sparse_table", 10'000, 100'000) {
+    bench_insert<SparseTable<std::size_t>>(state, 16);
+}
+
+NODEC_BENCHMARK(lookup_dense_paged, "containers/sparse/lookup_random/dense/paged_sparse_array", 10'000, 100'000, 1'000'000) {
+    bench_lookup<PagedSparseArray<std::size_t>>(state, 1);
+}
+
+NODEC_BENCHMARK(lookup_dense_table, "containers/sparse/lookup_random/dense/sparse_table", 10'000, 100'000, 1'000'000) {
+    bench_lookup<SparseTable<std::size_t>>(state, 1);
+}
+
+NODEC_BENCHMARK(lookup_sparse_paged, "containers/sparse/lookup_random/1_in_16/paged_sparse_array", 10'000, 100'000) {
+    bench_lookup<PagedSparseArray<std::size_t>>(state, 16);
+}
+
+NODEC_BENCHMARK(lookup_sparse_table, "containers/sparse/lookup_random/1_in_16/sparse_table", 10'000, 100'000) {
+    bench_lookup<SparseTable<std::size_t>>(state, 16);
+}
@@ -0,0 +1,835 @@
+#include "benchmark.hpp"
+
+#include <nodec/concurrent/thread_pool_executor.hpp>
+#include <nodec/entities/archetype_registry.hpp>
+#include <nodec/entities/hierarchy.hpp>
+#include <nodec/entities/registry.hpp>
+#include <nodec/entities/snapshot.hpp>
+#include <nodec/gfx/gfx.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// The default 32 bits layout holds 2^20 entities, so the suite uses 64 bits identifiers
+// on every count to keep the results comparable from 10k to 10M.
+enum class BenchmarkEntity : std::uint64_t {};
+
+} // namespace
+
+template<>
+struct nodec::entities::entity_traits<BenchmarkEntity>
+    : nodec::entities::basic_entity_traits<nodec::entities::entity_layout<BenchmarkEntity, 40, 24>> {};
+
+namespace {
+
+using nodec::entities::BasicRegistry;
+
+using Entity = BenchmarkEntity;
+using Registry = BasicRegistry<Entity>;
+
+struct Position {
+    float x, y, z;
+};
+
+struct Velocity {
+    float x, y, z;
+};
+
+struct Mass {
+    float value;
+};
+
+struct Drag {
+    float value;
+};
+
+std::vector<Entity> create_entities(Registry &registry, std::size_t count) {
+    std::vector<Entity> entities(count);
+    registry.create_entities(entities.begin(), entities.end());
+    return entities;
+}
+
+template<typename... Components>
+void emplace_all(Registry &registry, const std::vector<Entity> &entities) {
+    using Expander = int[];
+    (void)Expander{0, ((void)registry.insert_components<Components>(entities.begin(), entities.end()), 0)...};
+}
+
+} // namespace
+
+NODEC_BENCHMARK(create_destroy, "entities/create_destroy", NODEC_BENCHMARK_ALL_COUNTS) {
+    Registry registry;
+    std::vector<Entity> entities(state.entity_count());
+
+    state.measure(entities.size() * 2, [&]() {
+        registry.create_entities(entities.begin(), entities.end());
+        registry.destroy_entities(entities.begin(), entities.end());
+    });
+    state.set_memory_bytes(registry.memory_stats().total_bytes());
+}
+
+NODEC_BENCHMARK(emplace_remove, "entities/emplace_remove", NODEC_BENCHMARK_ALL_COUNTS) {
+    Registry registry;
+    const auto entities = create_entities(registry, state.entity_count());
+
+    state.measure(entities.size() * 2, [&]() {
+        for (const auto entity : entities) {
+            registry.emplace_component<Position>(entity, 1.f, 2.f, 3.f);
+        }
+        // A component constructed and destroyed before a flush cancels out, so flush in between.
+        registry.flush_component_events();
+        for (const auto entity : entities) {
+            registry.remove_component<Position>(entity);
+        }
+    });
+    state.set_memory_bytes(registry.memory_stats().total_bytes());
+}
+
+NODEC_BENCHMARK(view_1, "entities/view/1_component", NODEC_BENCHMARK_ALL_COUNTS) {
+    Registry registry;
+    const auto entities = create_entities(registry, state.entity_count());
+    emplace_all<Position>(registry, entities);
+
+    state.measure(entities.size(), [&]() {
+        registry.view<Position>().each([](auto, Position &position) {
+            position.x += 1.f;
+        });
+    });
+    state.set_memory_bytes(registry.memory_stats().total_bytes());
+}
+
+NODEC_BENCHMARK(view_2, "entities/view/2_components", 10'000, 100'000, 1'000'000) {
+    Registry registry;
+    const auto entities = create_entities(registry, state.entity_count());
+    emplace_all<Position, Velocity>(registry, entities);
+
+    state.measure(entities.size(), [&]() {
+        registry.view<Position, Velocity>().each([](auto, Position &position, const Velocity &velocity) {
+            position.x += velocity.x;
+        });
+    });
+    state.set_memory_bytes(registry.memory_stats().total_bytes());
+}
+
+namespace {
+
+/**
+ * @brief The same loop as view_2, split over a pool of the given threads.
+ */
+void bench_view_2_parallel(nodec_benchmarks::State &state, unsigned int threads) {
+    Registry registry;
+    const auto entities = create_entities(registry, state.entity_count());
+    emplace_all<Position, Velocity>(registry, entities);
+
+    nodec::concurrent::ThreadPoolExecutor executor{threads};
+    state.measure(entities.size(), [&]() {
+        registry.view<Position, Velocity>().each_parallel(
+            executor, [](auto, Position &position, const Velocity &velocity) { position.x += velocity.x; }, 4096);
+    });
+    state.set_memory_bytes(registry.memory_stats().total_bytes());
+}
+
+} // namespace
+
+NODEC_BENCHMARK(view_2_parallel_1, "entities/view/2_components/each_parallel/1_thread", 10'000, 100'000, 1'000'000) {
+    bench_view_2_parallel(state, 1);
+}
+
+NODEC_BENCHMARK(view_2_parallel_2, "entities/view/2_components/each_parallel/2_threads", 10'000, 100'000, 1'000'000) {
+    bench_view_2_parallel(state, 2);
+}
+
+NODEC_BENCHMARK(view_2_parallel_4, "entities/view/2_components/each_parallel/4_threads", 10'000, 100'000, 1'000'000) {
+    bench_view_2_parallel(state, 4);
+}
+
+NODEC_BENCHMARK(view_2_parallel_8, "entities/view/2_components/each_parallel/8_threads", 10'000, 100'000, 1'000'000) {
+    bench_view_2_parallel(state, 8);
+}
+
+NODEC_BENCHMARK(view_4, "entities/view/4_components", 10'000, 100'000, 1'000'000) {
+    Registry registry;
+    const auto entities = create_entities(registry, state.entity_count());
+    emplace_all<Position, Velocity, Mass, Drag>(registry, entities);
+
+    state.measure(entities.size(), [&]() {
+        registry.view<Position, Velocity, Mass, Drag>().each(
+            [](auto, Position &position, Velocity &velocity, const Mass &mass, const Drag &drag) {
+                velocity.x -= velocity.x * drag.value / mass.value;
+                position.x += velocity.x;
+            });
+    });
+    state.set_memory_bytes(registry.memory_stats().total_bytes());
+}
+
+namespace {
+
+void bench_get(nodec_benchmarks::State &state, bool random) {
+    Registry registry;
+    auto entities = create_entities(registry, state.entity_count());
+    emplace_all<Position>(registry, entities);
+
+    if (random) {
+        std::shuffle(entities.begin(), entities.end(), std::mt19937(42));
+    }
+
+    float sum = 0.f;
+    state.measure(entities.size(), [&]() {
+        for (const auto entity : entities) {
+            sum += registry.get_component<Position>(entity).x;
+        }
+    });
+    nodec_benchmarks::do_not_optimize_away(sum);
+    state.set_memory_bytes(registry.memory_stats().total_bytes());
+}
+
+} // namespace
+
+NODEC_BENCHMARK(get_sequential, "entities/get/sequential", NODEC_BENCHMARK_ALL_COUNTS) {
+    bench_get(state, false);
+}
+
+NODEC_BENCHMARK(get_random, "entities/get/random", NODEC_BENCHMARK_ALL_COUNTS) {
+    bench_get(state, true);
+}
+
+namespace {
+
+void bench_component_events(nodec_benchmarks::State &state, bool deferred) {
+    Registry registry;
+    registry.set_component_events_deferred(deferred);
+
+    std::size_t observed = 0;
+    for (int i = 0; i < 8; ++i) {
+        registry.component_constructed<Position>().connect([&](auto &, auto) { ++observed; });
+        registry.component_destroyed<Position>().connect([&](auto &, auto) { ++observed; });
+        registry.components_constructed<Position>().connect([&](auto &, auto batch) { observed += batch.size(); });
+        registry.components_destroyed<Position>().connect([&](auto &, auto batch) { observed += batch.size(); });
+    }
+
+    const auto entities = create_entities(registry, state.entity_count());
+    state.measure(entities.size() * 2, [&]() {
+        for (const auto entity : entities) {
+            registry.emplace_component<Position>(entity, 1.f, 2.f, 3.f);
+        }
+        // A component constructed and destroyed before a flush cancels out, so flush in between.
+        registry.flush_component_events();
+        for (const auto entity : entities) {
+            registry.remove_component<Position>(entity);
+        }
+        registry.flush_component_events();
+    });
+    nodec_benchmarks::do_not_optimize_away(observed);
+    state.set_memory_bytes(registry.memory_stats().total_bytes());
+}
+
+} // namespace
+
+NODEC_BENCHMARK(component_events_immediate, "entities/component_events/8_listeners/immediate", 10'000, 100'000, 1'000'000) {
+    bench_component_events(state, false);
+}
+
+NODEC_BENCHMARK(component_events_deferred, "entities/component_events/8_listeners/deferred", 10'000, 100'000, 1'000'000) {
+    bench_component_events(state, true);
+}
+
+NODEC_BENCHMARK(create_destroy_32_bits, "entities/create_destroy/32_bits_layout", 10'000, 100'000, 1'000'000) {
+    // The default layout, which holds 2^20 entities.
+    using nodec::entities::Entity;
+
+    nodec::entities::Registry registry;
+    std::vector<Entity> entities(state.entity_count());
+
+    state.measure(entities.size() * 2, [&]() {
+        registry.create_entities(entities.begin(), entities.end());
+        registry.destroy_entities(entities.begin(), entities.end());
+    });
+    state.set_memory_bytes(registry.memory_stats().total_bytes());
+}
+
+namespace {
+
+void bench_spawn(nodec_benchmarks::State &state, bool bulk) {
+    Registry registry;
+    std::vector<Entity> entities(state.entity_count());
+
+    state.measure(entities.size(), [&]() {
+        if (bulk) {
+            registry.create_entities(entities.begin(), entities.end());
+            registry.insert_components(entities.begin(), entities.end(), Position{0.f, 0.f, 0.f});
+            registry.insert_components(entities.begin(), entities.end(), Velocity{1.f, 0.f, 1.f});
+        } else {
+            for (auto &entity : entities) {
+                entity = registry.create_entity();
+                registry.emplace_component<Position>(entity, 0.f, 0.f, 0.f);
+                registry.emplace_component<Velocity>(entity, 1.f, 0.f, 1.f);
+            }
+        }
+        registry.destroy_entities(entities.begin(), entities.end());
+    });
+    state.set_memory_bytes(registry.memory_stats().total_bytes());
+}
+
+} // namespace
+
+NODEC_BENCHMARK(spawn_per_entity, "entities/spawn/2_components/per_entity", 10'000, 100'000, 1'000'000) {
+    bench_spawn(state, false);
+}
+
+NODEC_BENCHMARK(spawn_bulk, "entities/spawn/2_components/bulk", 10'000, 100'000, 1'000'000) {
+    bench_spawn(state, true);
+}
+
+namespace {
+
+void bench_clones(nodec_benchmarks::State &state, bool instantiate) {
+    Registry registry;
+    const auto prototype = registry.create_entity();
+    registry.emplace_component<Position>(prototype, 0.f, 0.f, 0.f);
+    registry.emplace_component<Velocity>(prototype, 1.f, 2.f, 3.f);
+    registry.emplace_component<Mass>(prototype, 1.f);
+    registry.emplace_component<Drag>(prototype, 0.5f);
+
+    // The entity count is the number of the clones.
+    std::vector<Entity> clones(state.entity_count());
+    state.measure(clones.size(), [&]() {
+        if (instantiate) {
+            registry.instantiate(prototype, clones.size(), clones.begin());
+        } else {
+            for (auto &clone : clones) {
+                clone = registry.create_entity();
+                registry.emplace_component<Position>(clone, registry.get_component<Position>(prototype));
+                registry.emplace_component<Velocity>(clone, registry.get_component<Velocity>(prototype));
+                registry.emplace_component<Mass>(clone, registry.get_component<Mass>(prototype));
+                registry.emplace_component<Drag>(clone, registry.get_component<Drag>(prototype));
+            }
+        }
+        registry.destroy_entities(clones.begin(), clones.end());
+    });
+    state.set_memory_bytes(registry.memory_stats().total_bytes());
+}
+
+} // namespace
+
+NODEC_BENCHMARK(clones_per_entity, "entities/spawn/4_components_clones/per_entity", 10'000, 100'000) {
+    bench_clones(state, false);
+}
+
+NODEC_BENCHMARK(clones_instantiate, "entities/spawn/4_components_clones/instantiate", 10'000, 100'000) {
+    bench_clones(state, true);
+}
+
+namespace {
+
+//! Large non-trivial component like a mesh renderer.
+template<int Tag>
+struct LargeComponent {
+    std::string name;
+    std::array<float, 48> data;
+};
+
+using VectorLarge = LargeComponent<0>;
+using PagedLarge = LargeComponent<1>;
+
+} // namespace
+
+template<>
+struct nodec::entities::component_traits<PagedLarge> {
+    static constexpr std::size_t page_size = 1024;
+};
+
+namespace {
+
+template<typename Component>
+void bench_emplace_large(nodec_benchmarks::State &state) {
+    Registry registry;
+    const auto entities = create_entities(registry, state.entity_count());
+
+    state.measure(entities.size() * 2, [&]() {
+        for (const auto entity : entities) {
+            registry.emplace_component<Component>(entity, Component{"a mesh renderer with a long name", {}});
+        }
+        registry.clear_component<Component>();
+    });
+    state.set_memory_bytes(registry.memory_stats().total_bytes());
+}
+
+} // namespace
+
+NODEC_BENCHMARK(emplace_large_vector, "entities/emplace_clear/large_component/vector", 10'000, 100'000) {
+    bench_emplace_large<VectorLarge>(state);
+}
+
+NODEC_BENCHMARK(emplace_large_paged, "entities/emplace_clear/large_component/paged", 10'000, 100'000) {
+    bench_emplace_large<PagedLarge>(state);
+}
+
+namespace {
+
+template<int N>
+struct ManyComponent {
+    int value;
+};
+
+template<int... Ns>
+void touch_pools(Registry &registry, std::integer_sequence<int, Ns...>) {
+    // Create the pools, as an application with many component types does.
+    const auto entity = registry.create_entity();
+    using Expander = int[];
+    (void)Expander{0, (registry.emplace_component<ManyComponent<Ns>>(entity), 0)...};
+    registry.destroy_entity(entity);
+}
+
+template<int PoolCount>
+void bench_destroy(nodec_benchmarks::State &state) {
+    Registry registry;
+    touch_pools(registry, std::make_integer_sequence<int, PoolCount>{});
+
+    std::vector<Entity> entities(state.entity_count());
+    state.measure(entities.size(), [&]() {
+        registry.create_entities(entities.begin(), entities.end());
+        registry.insert_components(entities.begin(), entities.end(), ManyComponent<0>{});
+        registry.insert_components(entities.begin(), entities.end(), ManyComponent<PoolCount / 2>{});
+        registry.insert_components(entities.begin(), entities.end(), ManyComponent<PoolCount - 1>{});
+        registry.destroy_entities(entities.begin(), entities.end());
+    });
+    state.set_memory_bytes(registry.memory_stats().total_bytes());
+}
+
+} // namespace
+
+NODEC_BENCHMARK(destroy_3_of_3, "entities/create_destroy/3_components/3_pools", 10'000, 100'000, 1'000'000) {
+    bench_destroy<3>(state);
+}
+
+NODEC_BENCHMARK(destroy_3_of_160, "entities/create_destroy/3_components/160_pools", 10'000, 100'000, 1'000'000) {
+    bench_destroy<160>(state);
+}
+
+namespace {
+
+template<typename... Components, typename Func>
+void bench_view_iterator(nodec_benchmarks::State &state, Func func) {
+    Registry registry;
+    const auto entities = create_entities(registry, state.entity_count());
+    emplace_all<Components...>(registry, entities);
+
+    state.measure(entities.size(), [&]() {
+        auto view = registry.view<Components...>();
+        for (const auto entity : view) {
+            func(view.template get<Components>(entity)...);
+        }
+    });
+    state.set_memory_bytes(registry.memory_stats().total_bytes());
+}
+
+} // namespace
+
+NODEC_BENCHMARK(view_1_iterator, "entities/view/1_component/iterator", 10'000, 100'000, 1'000'000) {
+    bench_view_iterator<Position>(state, [](Position &position) {
+        position.x += 1.f;
+    });
+}
+
+NODEC_BENCHMARK(view_2_iterator, "entities/view/2_components/iterator", 10'000, 100'000, 1'000'000) {
+    bench_view_iterator<Position, Velocity>(state, [](Position &position, const Velocity &velocity) {
+        position.x += velocity.x;
+    });
+}
+
+NODEC_BENCHMARK(view_4_iterator, "entities/view/4_components/iterator", 10'000, 100'000, 1'000'000) {
+    bench_view_iterator<Position, Velocity, Mass, Drag>(
+        state, [](Position &position, Velocity &velocity, const Mass &mass, const Drag &drag) {
+            velocity.x -= velocity.x * drag.value / mass.value;
+            position.x += velocity.x;
+        });
+}
+
+NODEC_BENCHMARK(runtime_view_2, "entities/runtime_view/2_components", 10'000, 100'000, 1'000'000) {
+    Registry registry;
+    const auto entities = create_entities(registry, state.entity_count());
+    emplace_all<Position, Velocity>(registry, entities);
+
+    const std::array<nodec::type_info, 2> types{nodec::type_id<Position>(), nodec::type_id<Velocity>()};
+    state.measure(entities.size(), [&]() {
+        registry.runtime_view(types).each([](auto, nodec::ArrayView<void *> components) {
+            static_cast<Position *>(components[0])->x += static_cast<Velocity *>(components[1])->x;
+        });
+    });
+    state.set_memory_bytes(registry.memory_stats().total_bytes());
+}
+
+namespace {
+
+void bench_group(nodec_benchmarks::State &state, bool grouped) {
+    Registry registry;
+    if (grouped) registry.group<Position, Velocity, Mass>();
+
+    const auto entities = create_entities(registry, state.entity_count());
+    emplace_all<Position, Velocity>(registry, entities);
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+        // Most of the entities match.
+        if (i % 10 != 0) registry.emplace_component<Mass>(entities[i], 1.f);
+    }
+
+    const auto update = [](auto, Position &position, Velocity &velocity, const Mass &mass) {
+        velocity.x /= mass.value;
+        position.x += velocity.x;
+    };
+    state.measure(entities.size(), [&]() {
+        if (grouped) {
+            registry.group<Position, Velocity, Mass>().each(update);
+        } else {
+            registry.view<Position, Velocity, Mass>().each(update);
+        }
+    });
+    state.set_memory_bytes(registry.memory_stats().total_bytes());
+}
+
+} // namespace
+
+NODEC_BENCHMARK(view_3_partial, "entities/view/3_components_90_percent", 10'000, 100'000, 1'000'000) {
+    bench_group(state, false);
+}
+
+NODEC_BENCHMARK(group_3_partial, "entities/group/3_components_90_percent", 10'000, 100'000, 1'000'000) {
+    bench_group(state, true);
+}
+
+namespace {
+
+void bench_churned_view(nodec_benchmarks::State &state, bool sorted) {
+    Registry registry;
+    auto entities = create_entities(registry, state.entity_count());
+    emplace_all<Position>(registry, entities);
+
+    // The velocities are added in another order, as after some churn.
+    std::shuffle(entities.begin(), entities.end(), std::mt19937(42));
+    for (const auto entity : entities) {
+        registry.emplace_component<Velocity>(entity, 1.f, 0.f, 1.f);
+    }
+    if (sorted) registry.sort_as<Velocity, Position>();
+
+    state.measure(entities.size(), [&]() {
+        registry.view<Position, Velocity>().each([](auto, Position &position, const Velocity &velocity) {
+            position.x += velocity.x;
+        });
+    });
+    state.set_memory_bytes(registry.memory_stats().total_bytes());
+}
+
+} // namespace
+
+NODEC_BENCHMARK(view_2_shuffled, "entities/view/2_components/shuffled", 10'000, 100'000, 1'000'000) {
+    bench_churned_view(state, false);
+}
+
+NODEC_BENCHMARK(view_2_sort_as, "entities/view/2_components/shuffled_then_sort_as", 10'000, 100'000, 1'000'000) {
+    bench_churned_view(state, true);
+}
+
+namespace {
+
+struct TagEmpty {};
+
+struct TagByte {
+    char unused;
+};
+
+template<typename Tag>
+void bench_tag_view(nodec_benchmarks::State &state) {
+    Registry registry;
+    const auto entities = create_entities(registry, state.entity_count());
+    emplace_all<Position, Tag>(registry, entities);
+
+    state.measure(entities.size(), [&]() {
+        registry.view<Tag, Position>().each([](auto, auto &&, Position &position) { position.x += 1.f; });
+    });
+    state.set_memory_bytes(registry.memory_stats().total_bytes());
+}
+
+} // namespace
+
+NODEC_BENCHMARK(view_empty_tag, "entities/view/tag/empty", 10'000, 100'000, 1'000'000) {
+    bench_tag_view<TagEmpty>(state);
+}
+
+NODEC_BENCHMARK(view_byte_tag, "entities/view/tag/1_byte", 10'000, 100'000, 1'000'000) {
+    bench_tag_view<TagByte>(state);
+}
+
+namespace {
+
+void bench_sync(nodec_benchmarks::State &state, bool dirty) {
+    Registry registry;
+    const auto entities = create_entities(registry, state.entity_count());
+    emplace_all<Position, Velocity>(registry, entities);
+
+    std::mt19937 rng(42);
+    auto dirty_view = registry.dirty_view<Position, Velocity>();
+    const auto sync = [](auto, const Position &position, Velocity &velocity) {
+        velocity.x = position.x;
+    };
+
+    // 1% of the entities change between the syncs.
+    state.measure(entities.size(), [&]() {
+        for (std::size_t i = 0; i < entities.size() / 100; ++i) {
+            registry.patch<Position>(entities[rng() % entities.size()], [](Position &position) { position.x += 1.f; });
+        }
+        if (dirty) {
+            dirty_view.each(sync);
+        } else {
+            registry.view<Position, Velocity>().each(sync);
+            registry.dirty_view<Position>().clear();
+        }
+    });
+    state.set_memory_bytes(registry.memory_stats().total_bytes());
+}
+
+} // namespace
+
+NODEC_BENCHMARK(sync_full_view, "entities/sync/1_percent_changed/full_view", 10'000, 100'000, 1'000'000) {
+    bench_sync(state, false);
+}
+
+NODEC_BENCHMARK(sync_dirty_view, "entities/sync/1_percent_changed/dirty_view", 10'000, 100'000, 1'000'000) {
+    bench_sync(state, true);
+}
+
+namespace {
+
+using Snapshot = nodec::entities::BasicSnapshot<Entity>;
+using SnapshotLoader = nodec::entities::BasicSnapshotLoader<Entity>;
+
+} // namespace
+
+NODEC_BENCHMARK(snapshot_save, "entities/snapshot/2_components/save", 10'000, 100'000, 1'000'000) {
+    Registry registry;
+    const auto entities = create_entities(registry, state.entity_count());
+    emplace_all<Position, Velocity>(registry, entities);
+
+    std::size_t bytes = 0;
+    state.measure(entities.size(), [&]() {
+        std::ostringstream stream;
+        Snapshot{registry}.entities(stream).components<Position, Velocity>(stream);
+        bytes = static_cast<std::size_t>(stream.tellp());
+    });
+    state.set_memory_bytes(bytes);
+}
+
+NODEC_BENCHMARK(snapshot_load, "entities/snapshot/2_components/load", 10'000, 100'000, 1'000'000) {
+    std::string data;
+    {
+        Registry registry;
+        const auto entities = create_entities(registry, state.entity_count());
+        emplace_all<Position, Velocity>(registry, entities);
+
+        std::ostringstream stream;
+        Snapshot{registry}.entities(stream).components<Position, Velocity>(stream);
+        data = stream.str();
+    }
+
+    std::size_t bytes = 0;
+    state.measure(state.entity_count(), [&]() {
+        Registry registry;
+        std::istringstream stream(data);
+        SnapshotLoader{registry}.entities(stream).components<Position, Velocity>(stream);
+        bytes = registry.memory_stats().total_bytes();
+    });
+    state.set_memory_bytes(bytes);
+}
+
+NODEC_BENCHMARK(snapshot_copy_baseline, "entities/snapshot/2_components/per_entity_copy_baseline", 10'000, 100'000, 1'000'000) {
+    Registry source;
+    const auto entities = create_entities(source, state.entity_count());
+    emplace_all<Position, Velocity>(source, entities);
+
+    std::size_t bytes = 0;
+    state.measure(entities.size(), [&]() {
+        Registry registry;
+        source.each_entity([&](const Entity entity) {
+            const auto created = registry.create_entity();
+            registry.emplace_component<Position>(created, source.get_component<Position>(entity));
+            registry.emplace_component<Velocity>(created, source.get_component<Velocity>(entity));
+        });
+        bytes = registry.memory_stats().total_bytes();
+    });
+    state.set_memory_bytes(bytes);
+}
+
+namespace {
+
+struct ChurnTag {};
+
+template<typename Backend>
+using BackendRegistry = nodec::entities::registry_for_t<Entity, Backend>;
+
+template<typename Backend>
+void prepare_backend(BackendRegistry<Backend> &registry, std::vector<Entity> &entities) {
+    for (auto &entity : entities) {
+        entity = registry.create_entity();
+        registry.template emplace_component<Position>(entity, 0.f, 0.f, 0.f);
+        registry.template emplace_component<Velocity>(entity, 1.f, 2.f, 3.f);
+        registry.template emplace_component<Mass>(entity, 1.f);
+    }
+}
+
+template<typename Backend>
+void bench_backend_view(nodec_benchmarks::State &state) {
+    BackendRegistry<Backend> registry;
+    std::vector<Entity> entities(state.entity_count());
+    prepare_backend<Backend>(registry, entities);
+
+    state.measure(entities.size(), [&]() {
+        registry.template view<Position, Velocity, Mass>().each(
+            [](auto, Position &position, Velocity &velocity, const Mass &mass) {
+                velocity.x /= mass.value;
+                position.x += velocity.x;
+            });
+    });
+}
+
+template<typename Backend>
+void bench_backend_churn(nodec_benchmarks::State &state) {
+    BackendRegistry<Backend> registry;
+    std::vector<Entity> entities(state.entity_count());
+    prepare_backend<Backend>(registry, entities);
+
+    // A tag added to and removed from every tenth entity, which moves it between archetypes.
+    state.measure(entities.size() / 10 * 2, [&]() {
+        for (std::size_t i = 0; i < entities.size(); i += 10) {
+            registry.template emplace_component<ChurnTag>(entities[i]);
+        }
+        for (std::size_t i = 0; i < entities.size(); i += 10) {
+            registry.template remove_component<ChurnTag>(entities[i]);
+        }
+    });
+}
+
+} // namespace
+
+NODEC_BENCHMARK(backend_view_sparse_set, "entities/backend/sparse_set/view_3_components", 10'000, 100'000) {
+    bench_backend_view<nodec::entities::SparseSetBackend>(state);
+}
+
+NODEC_BENCHMARK(backend_view_archetype, "entities/backend/archetype/view_3_components", 10'000, 100'000) {
+    bench_backend_view<nodec::entities::ArchetypeBackend>(state);
+}
+
+NODEC_BENCHMARK(backend_churn_sparse_set, "entities/backend/sparse_set/tag_churn", 10'000, 100'000) {
+    bench_backend_churn<nodec::entities::SparseSetBackend>(state);
+}
+
+NODEC_BENCHMARK(backend_churn_archetype, "entities/backend/archetype/tag_churn", 10'000, 100'000) {
+    bench_backend_churn<nodec::entities::ArchetypeBackend>(state);
+}
+
+namespace {
+
+using Hierarchy = nodec::entities::BasicHierarchy<Entity>;
+
+struct LocalTransform {
+    nodec::Vector3f position;
+    nodec::Quaternionf rotation;
+    nodec::Vector3f scale;
+    Entity parent;
+};
+
+nodec::Matrix4x4f local_matrix(const LocalTransform &local) {
+    return nodec::gfx::trs(local.position, local.rotation, local.scale);
+}
+
+/**
+ * @brief Builds a random forest of 16 trees. The transforms are stored in a shuffled order.
+ */
+void prepare_transforms(Registry &registry, Hierarchy &hierarchy, std::vector<Entity> &entities, std::mt19937 &rng) {
+    registry.create_entities(entities.begin(), entities.end());
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+        const auto parent = i < 16 ? nodec::entities::null_entity
+                                   : entities[std::uniform_int_distribution<std::size_t>(0, i - 1)(rng)];
+        hierarchy.set_parent(entities[i], parent);
+    }
+
+    auto shuffled = entities;
+    std::shuffle(shuffled.begin(), shuffled.end(), rng);
+    for (const auto entity : shuffled) {
+        registry.emplace_component<LocalTransform>(
+            entity, LocalTransform{nodec::Vector3f(1.f, 0.f, 0.f), nodec::Quaternionf::identity,
+                                   nodec::Vector3f::ones, hierarchy.parent(entity)});
+    }
+}
+
+/**
+ * @brief Propagates the world matrices with the hierarchy.
+ *
+ * @param all If true, the roots are marked changed, so every entity is visited.
+ *   Otherwise, 1% of the entities picked at random are marked changed.
+ */
+void bench_propagate(nodec_benchmarks::State &state, bool all) {
+    Registry registry;
+    Hierarchy hierarchy;
+    std::mt19937 rng(42);
+    std::vector<Entity> entities(state.entity_count());
+    prepare_transforms(registry, hierarchy, entities, rng);
+
+    std::vector<nodec::Matrix4x4f> world(hierarchy.size());
+    const auto propagate = [&]() {
+        return hierarchy.propagate([&](const Entity entity, std::size_t pos, std::size_t parent_pos) {
+            const auto local = local_matrix(registry.get_component<LocalTransform>(entity));
+            world[pos] = parent_pos == Hierarchy::npos ? local : world[parent_pos] * local;
+        });
+    };
+    // The first pass rebuilds the order.
+    propagate();
+
+    std::uniform_int_distribution<std::size_t> pick(0, entities.size() - 1);
+    state.measure(entities.size(), [&]() {
+        if (all) {
+            for (std::size_t i = 0; i < 16; ++i) hierarchy.mark_changed(entities[i]);
+        } else {
+            for (std::size_t i = 0; i < entities.size() / 100; ++i) hierarchy.mark_changed(entities[pick(rng)]);
+        }
+        propagate();
+    });
+    nodec_benchmarks::do_not_optimize_away(world);
+}
+
+} // namespace
+
+NODEC_BENCHMARK(transforms_parent_chasing, "entities/hierarchy/transforms/parent_chasing_baseline", 10'000, 100'000) {
+    Registry registry;
+    Hierarchy hierarchy;
+    std::mt19937 rng(42);
+    std::vector<Entity> entities(state.entity_count());
+    prepare_transforms(registry, hierarchy, entities, rng);
+
+    float checksum = 0.f;
+    state.measure(entities.size(), [&]() {
+        registry.view<LocalTransform>().each([&](auto, const LocalTransform &local) {
+            auto world = local_matrix(local);
+            for (auto parent = local.parent; parent != nodec::entities::null_entity;) {
+                const auto &parent_local = registry.get_component<LocalTransform>(parent);
+                world = local_matrix(parent_local) * world;
+                parent = parent_local.parent;
+            }
+            checksum += world.m14;
+        });
+    });
+    nodec_benchmarks::do_not_optimize_away(checksum);
+}
+
+NODEC_BENCHMARK(transforms_propagate_all, "entities/hierarchy/transforms/propagate_all_changed", 10'000, 100'000) {
+    bench_propagate(state, true);
+}
+
+NODEC_BENCHMARK(transforms_propagate_1_percent, "entities/hierarchy/transforms/propagate_1_percent_changed", 10'000, 100'000) {
+    bench_propagate(state, false);
+}
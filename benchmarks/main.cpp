@@ -0,0 +1,139 @@
+// The benchmark suite of nodec.
+//
+// Usage: nodec_benchmarks [--filter <substring>] [--max-entities <count>] [--min-time <seconds>]
+//                         [--output <file>] [--list]
+//
+// The results are written as JSON to the output file, or to the standard output.
+// The progress goes to the standard error.
+
+#include "benchmark.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace {
+
+std::string escape_json(const std::string &str) {
+    std::string escaped;
+    for (const auto c : str) {
+        switch (c) {
+        case '"': escaped += "\\\""; break;
+        case '\\': escaped += "\\\\"; break;
+        case '\n': escaped += "\\n"; break;
+        default: escaped += c; break;
+        }
+    }
+    return escaped;
+}
+
+std::string compiler_name() {
+    std::ostringstream oss;
+#if defined(__clang__)
+    oss << "clang " << __clang_major__ << "." << __clang_minor__ << "." << __clang_patchlevel__;
+#elif defined(__GNUC__)
+    oss << "gcc " << __GNUC__ << "." << __GNUC_MINOR__ << "." << __GNUC_PATCHLEVEL__;
+#elif defined(_MSC_VER)
+    oss << "msvc " << _MSC_VER;
+#else
+    oss << "unknown";
+#endif
+    return oss.str();
+}
+
+void write_json(std::ostream &out, const std::vector<nodec_benchmarks::Result> &results) {
+    out << "{\n"
+        << "  \"suite\": \"nodec_benchmarks\",\n"
+        << "  \"compiler\": \"" << escape_json(compiler_name()) << "\",\n"
+#ifdef NDEBUG
+        << "  \"assertions\": false,\n"
+#else
+        << "  \"assertions\": true,\n"
+#endif
+        << "  \"results\": [";
+
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const auto &result = results[i];
+        out << (i == 0 ? "\n" : ",\n")
+            << "    {"
+            << "\"name\": \"" << escape_json(result.name) << "\", "
+            << "\"entities\": " << result.entity_count << ", "
+            << "\"operations\": " << result.operations << ", "
+            << "\"repetitions\": " << result.repetitions << ", "
+            << "\"seconds\": " << result.seconds << ", "
+            << "\"ops_per_second\": " << result.ops_per_second() << ", "
+            << "\"ns_per_op\": " << result.ns_per_op() << ", "
+            << "\"memory_bytes\": " << result.memory_bytes << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    using namespace nodec_benchmarks;
+
+    std::string filter;
+    std::string output;
+    std::size_t max_entities = static_cast<std::size_t>(-1);
+    double min_time = 0.2;
+    bool list = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const auto has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--filter") == 0 && has_value) {
+            filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--max-entities") == 0 && has_value) {
+            max_entities = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--min-time") == 0 && has_value) {
+            min_time = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--output") == 0 && has_value) {
+            output = argv[++i];
+        } else if (std::strcmp(argv[i], "--list") == 0) {
+            list = true;
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--filter <substring>] [--max-entities <count>] [--min-time <seconds>] [--output <file>] [--list]\n";
+            return 2;
+        }
+    }
+
+    std::vector<Result> results;
+    for (const auto &benchmark : benchmarks()) {
+        if (benchmark.name.find(filter) == std::string::npos) continue;
+
+        for (const auto entity_count : benchmark.entity_counts) {
+            if (entity_count > max_entities) continue;
+
+            if (list) {
+                std::cout << benchmark.name << " " << entity_count << "\n";
+                continue;
+            }
+
+            std::cerr << benchmark.name << " (" << entity_count << " entities)... " << std::flush;
+
+            State state(benchmark.name, entity_count, std::chrono::duration<double>(min_time));
+            benchmark.func(state);
+            results.push_back(state.result());
+
+            std::cerr << results.back().ns_per_op() << " ns/op\n";
+        }
+    }
+    if (list) return 0;
+
+    if (output.empty()) {
+        write_json(std::cout, results);
+        return 0;
+    }
+
+    std::ofstream file(output);
+    if (!file) {
+        std::cerr << "Cannot open " << output << "\n";
+        return 1;
+    }
+    write_json(file, results);
+    return 0;
+}
@@ -0,0 +1,219 @@
+#include "benchmark.hpp"
+
+#include <nodec/signals/concurrent_signal.hpp>
+#include <nodec/signals/dispatcher.hpp>
+#include <nodec/signals/signal.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using nodec::ArrayView;
+using namespace nodec::signals;
+
+struct Receiver {
+    void on_value(int value) {
+        sum += value;
+    }
+
+    int sum{0};
+};
+
+void bench_emit(nodec_benchmarks::State &state, int listener_count) {
+    Signal<void(int)> signal;
+
+    int sum = 0;
+    std::vector<Connection> connections;
+    for (int i = 0; i < listener_count; ++i) {
+        connections.emplace_back(signal.signal_interface().connect([&](int value) { sum += value; }));
+    }
+
+    // The entity count is the number of the emits.
+    state.measure(state.entity_count(), [&]() {
+        for (std::size_t i = 0; i < state.entity_count(); ++i) {
+            signal(1);
+        }
+    });
+    nodec_benchmarks::do_not_optimize_away(sum);
+}
+
+thread_local int local_sum = 0;
+
+void count_locally(int value) {
+    local_sum += value;
+}
+
+std::size_t emitter_thread_count() {
+    return (std::max)(2u, (std::min)(8u, std::thread::hardware_concurrency()));
+}
+
+/**
+ * @brief Emits from several threads at once. The entity count is the number of the emits per thread.
+ *
+ * @param emit void(), called by each thread.
+ */
+template<typename Emit>
+void bench_emit_threads(nodec_benchmarks::State &state, Emit emit) {
+    const auto thread_count = emitter_thread_count();
+    state.measure(state.entity_count() * thread_count, [&]() {
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < thread_count; ++t) {
+            threads.emplace_back([&]() {
+                for (std::size_t i = 0; i < state.entity_count(); ++i) {
+                    emit();
+                }
+            });
+        }
+        for (auto &thread : threads) thread.join();
+    });
+}
+
+} // namespace
+
+NODEC_BENCHMARK(emit_1, "signals/emit/1_listener", 10'000, 100'000, 1'000'000) {
+    bench_emit(state, 1);
+}
+
+NODEC_BENCHMARK(emit_8, "signals/emit/8_listeners", 10'000, 100'000, 1'000'000) {
+    bench_emit(state, 8);
+}
+
+NODEC_BENCHMARK(emit_8_members, "signals/emit/8_member_listeners", 10'000, 100'000, 1'000'000) {
+    Signal<void(int)> signal;
+
+    std::vector<Receiver> receivers(8);
+    std::vector<Connection> connections;
+    for (auto &receiver : receivers) {
+        connections.emplace_back(signal.signal_interface().connect<&Receiver::on_value>(receiver));
+    }
+
+    state.measure(state.entity_count(), [&]() {
+        for (std::size_t i = 0; i < state.entity_count(); ++i) {
+            signal(1);
+        }
+    });
+    nodec_benchmarks::do_not_optimize_away(receivers);
+}
+
+// The baseline of the type erasure by std::function.
+NODEC_BENCHMARK(emit_8_std_function, "signals/emit/8_std_function_baseline", 10'000, 100'000, 1'000'000) {
+    int sum = 0;
+    std::vector<std::function<void(int)>> callbacks;
+    for (int i = 0; i < 8; ++i) {
+        callbacks.emplace_back([&](int value) { sum += value; });
+    }
+
+    state.measure(state.entity_count(), [&]() {
+        for (std::size_t i = 0; i < state.entity_count(); ++i) {
+            for (const auto &callback : callbacks) {
+                callback(1);
+            }
+        }
+    });
+    nodec_benchmarks::do_not_optimize_away(sum);
+}
+
+// The entity count is the number of the connections, made and released in the scope of the connection objects.
+NODEC_BENCHMARK(connect_disconnect, "signals/connect_disconnect", 10'000, 100'000, 1'000'000) {
+    Signal<void(int)> signal;
+
+    int sum = 0;
+    std::vector<Connection> connections(state.entity_count());
+    state.measure(state.entity_count() * 2, [&]() {
+        for (auto &connection : connections) {
+            connection = signal.signal_interface().connect([&](int value) { sum += value; });
+        }
+        for (auto &connection : connections) {
+            connection.disconnect();
+        }
+
+        // Compacts the released slots.
+        signal(0);
+    });
+    nodec_benchmarks::do_not_optimize_away(sum);
+}
+
+// The listeners count on the thread local counters, so only the signal is shared between the threads.
+NODEC_BENCHMARK(emit_threads_concurrent, "signals/emit_threads/concurrent_signal", 10'000, 100'000, 1'000'000) {
+    ConcurrentSignal<void(int)> signal;
+
+    std::vector<Connection> connections;
+    for (int i = 0; i < 4; ++i) {
+        connections.emplace_back(signal.signal_interface().connect<&count_locally>());
+    }
+
+    bench_emit_threads(state, [&]() { signal(1); });
+    nodec_benchmarks::do_not_optimize_away(local_sum);
+}
+
+// The baseline of a Signal serialized by a mutex, as Logger did.
+NODEC_BENCHMARK(emit_threads_mutex, "signals/emit_threads/mutex_signal_baseline", 10'000, 100'000, 1'000'000) {
+    Signal<void(int)> signal;
+    std::mutex mutex;
+
+    std::vector<Connection> connections;
+    for (int i = 0; i < 4; ++i) {
+        connections.emplace_back(signal.signal_interface().connect<&count_locally>());
+    }
+
+    bench_emit_threads(state, [&]() {
+        std::lock_guard<std::mutex> lock(mutex);
+        signal(1);
+    });
+    nodec_benchmarks::do_not_optimize_away(local_sum);
+}
+
+namespace {
+
+struct Collision {
+    std::uint32_t a;
+    std::uint32_t b;
+    float impulse;
+};
+
+} // namespace
+
+// The baseline of an immediate signal call per event. The entity count is the number of the events.
+NODEC_BENCHMARK(events_immediate, "signals/events/immediate_signal_baseline", 10'000, 100'000, 1'000'000) {
+    Signal<void(const Collision &)> signal;
+
+    float total = 0.0f;
+    std::vector<Connection> connections;
+    for (int i = 0; i < 4; ++i) {
+        connections.emplace_back(signal.signal_interface().connect([&](const Collision &collision) {
+            total += collision.impulse;
+        }));
+    }
+
+    state.measure(state.entity_count(), [&]() {
+        for (std::size_t i = 0; i < state.entity_count(); ++i) {
+            signal(Collision{static_cast<std::uint32_t>(i), 0u, 1.0f});
+        }
+    });
+    nodec_benchmarks::do_not_optimize_away(total);
+}
+
+NODEC_BENCHMARK(events_dispatcher, "signals/events/dispatcher_batched", 10'000, 100'000, 1'000'000) {
+    Dispatcher dispatcher;
+
+    float total = 0.0f;
+    std::vector<Connection> connections;
+    for (int i = 0; i < 4; ++i) {
+        connections.emplace_back(dispatcher.events<Collision>().connect([&](ArrayView<const Collision> collisions) {
+            for (const auto &collision : collisions) total += collision.impulse;
+        }));
+    }
+
+    state.measure(state.entity_count(), [&]() {
+        for (std::size_t i = 0; i < state.entity_count(); ++i) {
+            dispatcher.enqueue<Collision>(static_cast<std::uint32_t>(i), 0u, 1.0f);
+        }
+        dispatcher.update();
+    });
+    nodec_benchmarks::do_not_optimize_away(total);
+}
@@ -1,6 +1,11 @@
 #ifndef NODEC__ALGORITHM_HPP_
 #define NODEC__ALGORITHM_HPP_
 
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <utility>
+
 namespace nodec {
 
 /**
@@ -17,6 +22,40 @@ constexpr const T &clamp(const T &v, const T &low, const T &high) {
     return v < low ? low : (high < v ? high : v);
 }
 
+/**
+ * @brief Function object to wrap std::sort.
+ */
+struct StdSort {
+    template<typename It, typename Compare = std::less<>>
+    void operator()(It first, It last, Compare compare = Compare{}) const {
+        std::sort(std::move(first), std::move(last), std::move(compare));
+    }
+};
+
+/**
+ * @brief Function object for the insertion sort.
+ *
+ * It runs in O(n + d) where d is the number of inversions, so it is much faster
+ * than StdSort on nearly sorted ranges. The sort is stable.
+ */
+struct InsertionSort {
+    template<typename It, typename Compare = std::less<>>
+    void operator()(It first, It last, Compare compare = Compare{}) const {
+        if (first == last) return;
+
+        for (auto it = std::next(first); it != last; ++it) {
+            auto value = std::move(*it);
+            auto pre = it;
+
+            for (; pre != first && compare(value, *std::prev(pre)); --pre) {
+                *pre = std::move(*std::prev(pre));
+            }
+
+            *pre = std::move(value);
+        }
+    }
+};
+
 } // namespace nodec
 
 #endif
\ No newline at end of file
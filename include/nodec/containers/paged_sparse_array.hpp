@@ -0,0 +1,205 @@
+#ifndef NODEC__CONTAINERS__PAGED_SPARSE_ARRAY_HPP_
+#define NODEC__CONTAINERS__PAGED_SPARSE_ARRAY_HPP_
+
+#include "../utility.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace nodec {
+namespace containers {
+
+/**
+ * The number of elements in a page.
+ * A page of std::size_t is 32 KiB, so 20 bits entity numbers need 256 pages at most.
+ */
+constexpr std::size_t DEFAULT_SPARSE_PAGE_SIZE = 4096;
+
+/**
+ * @brief Sparse array of integral values with O(1) direct indexing.
+ *
+ * The index space is split into fixed-size pages which are allocated on demand.
+ * Every page that has not been allocated yet points to one null page shared by
+ * all the arrays, so a lookup is always a page load followed by an element load,
+ * without any branch on the page itself.
+ *
+ * An element equal to the null value (the max value of T) is regarded as empty.
+ *
+ * @tparam T Integral value type.
+ * @tparam PAGE_SIZE The number of elements per page. Must be a power of two.
+ */
+template<typename T, std::size_t PAGE_SIZE>
+class BasicPagedSparseArray {
+    static_assert(std::is_integral<T>::value, "The value type must be integral.");
+    static_assert(PAGE_SIZE != 0 && (PAGE_SIZE & (PAGE_SIZE - 1)) == 0, "The page size must be a power of two.");
+
+public:
+    using size_type = std::size_t;
+    using value_type = T;
+
+    static constexpr value_type null_value = (std::numeric_limits<value_type>::max)();
+
+private:
+    static value_type *null_page() noexcept {
+        struct NullPage {
+            NullPage() {
+                std::fill(std::begin(values), std::end(values), null_value);
+            }
+            value_type values[PAGE_SIZE];
+        };
+
+        // The null page is never written. Writers check it before.
+        static NullPage page;
+        return page.values;
+    }
+
+    static size_type page_index(const size_type i) noexcept {
+        return i / PAGE_SIZE;
+    }
+
+    static size_type pos_in_page(const size_type i) noexcept {
+        return i & (PAGE_SIZE - 1);
+    }
+
+    value_type *page_assured(const size_type i) {
+        const auto index = page_index(i);
+        if (!(index < pages_.size())) {
+            pages_.resize(index + 1, null_page());
+        }
+
+        auto &page = pages_[index];
+        if (page == null_page()) {
+            page = new value_type[PAGE_SIZE];
+            std::fill(page, page + PAGE_SIZE, null_value);
+        }
+        return page;
+    }
+
+public:
+    BasicPagedSparseArray() {}
+
+    ~BasicPagedSparseArray() {
+        release();
+    }
+
+    BasicPagedSparseArray(BasicPagedSparseArray &&other) noexcept
+        : pages_(std::move(other.pages_)) {
+        other.pages_.clear();
+    }
+
+    BasicPagedSparseArray &operator=(BasicPagedSparseArray &&other) noexcept {
+        if (this == &other) return *this;
+
+        release();
+        pages_ = std::move(other.pages_);
+        other.pages_.clear();
+        return *this;
+    }
+
+    BasicPagedSparseArray(const BasicPagedSparseArray &) = delete;
+    BasicPagedSparseArray &operator=(const BasicPagedSparseArray &) = delete;
+
+public:
+    /**
+     * @brief Returns the reference to the element at i.
+     *
+     * If the element is empty, it is value-initialized first.
+     */
+    value_type &operator[](const size_type i) {
+        auto &value = page_assured(i)[pos_in_page(i)];
+        if (value == null_value) value = value_type{};
+        return value;
+    }
+
+    const value_type *try_get(const size_type i) const noexcept {
+        const auto index = page_index(i);
+        if (!(index < pages_.size())) return nullptr;
+
+        const auto *value = pages_[index] + pos_in_page(i);
+        return *value != null_value ? value : nullptr;
+    }
+
+    value_type *try_get(const size_type i) noexcept {
+        return const_cast<value_type *>(nodec::as_const(*this).try_get(i));
+    }
+
+    bool erase(const size_type i) noexcept {
+        auto *value = try_get(i);
+        if (!value) return false;
+
+        *value = null_value;
+        return true;
+    }
+
+    bool contains(const size_type i) const noexcept {
+        return try_get(i) != nullptr;
+    }
+
+    /**
+     * @brief Allocates the pages needed to hold the elements in [0, n).
+     */
+    void reserve(const size_type n) {
+        for (size_type i = 0; i < n; i += PAGE_SIZE) {
+            page_assured(i);
+        }
+    }
+
+    /**
+     * @brief Returns the number of the allocated pages.
+     */
+    size_type page_count() const noexcept {
+        return static_cast<size_type>(std::count_if(pages_.begin(), pages_.end(),
+                                                    [](const auto *page) { return page != null_page(); }));
+    }
+
+    /**
+     * @brief Returns the number of the elements the allocated pages can hold.
+     */
+    size_type capacity() const noexcept {
+        return page_count() * PAGE_SIZE;
+    }
+
+    /**
+     * @brief Returns the bytes allocated for the pages and the page table.
+     */
+    size_type memory_usage() const noexcept {
+        return capacity() * sizeof(value_type) + pages_.capacity() * sizeof(value_type *);
+    }
+
+    /**
+     * @brief Releases the pages without any element, and trims the page table.
+     */
+    void shrink_to_fit() {
+        for (auto &page : pages_) {
+            if (page == null_page()) continue;
+            if (std::all_of(page, page + PAGE_SIZE, [](const auto value) { return value == null_value; })) {
+                delete[] page;
+                page = null_page();
+            }
+        }
+
+        while (!pages_.empty() && pages_.back() == null_page()) pages_.pop_back();
+        pages_.shrink_to_fit();
+    }
+
+private:
+    void release() noexcept {
+        for (auto *page : pages_) {
+            if (page != null_page()) delete[] page;
+        }
+    }
+
+    std::vector<value_type *> pages_;
+};
+
+template<typename T>
+using PagedSparseArray = BasicPagedSparseArray<T, DEFAULT_SPARSE_PAGE_SIZE>;
+
+} // namespace containers
+} // namespace nodec
+
+#endif
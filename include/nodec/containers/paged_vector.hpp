@@ -0,0 +1,211 @@
+#ifndef NODEC__CONTAINERS__PAGED_VECTOR_HPP_
+#define NODEC__CONTAINERS__PAGED_VECTOR_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace nodec {
+namespace containers {
+
+/**
+ * @brief Sequence container which stores its elements in fixed-size pages.
+ *
+ * Unlike std::vector, growing never relocates the existing elements. A new page
+ * is allocated when the last one is full, so the addresses of the elements stay
+ * stable until they are removed, and the cost of growth is O(PAGE_SIZE)
+ * regardless of the size.
+ *
+ * @tparam T Element type.
+ * @tparam PAGE_SIZE The number of elements per page. Must be a power of two.
+ */
+template<typename T, std::size_t PAGE_SIZE>
+class BasicPagedVector {
+    static_assert(PAGE_SIZE != 0 && (PAGE_SIZE & (PAGE_SIZE - 1)) == 0, "The page size must be a power of two.");
+
+    using Storage = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+public:
+    using size_type = std::size_t;
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+
+    static constexpr size_type page_size = PAGE_SIZE;
+
+private:
+    static size_type page_index(const size_type i) noexcept {
+        return i / PAGE_SIZE;
+    }
+
+    static size_type pos_in_page(const size_type i) noexcept {
+        return i & (PAGE_SIZE - 1);
+    }
+
+    T *address(const size_type i) const noexcept {
+        return reinterpret_cast<T *>(&pages_[page_index(i)][pos_in_page(i)]);
+    }
+
+    void page_assured() {
+        if (page_index(size_) < pages_.size()) return;
+        pages_.emplace_back(new Storage[PAGE_SIZE]);
+    }
+
+public:
+    BasicPagedVector() {}
+
+    ~BasicPagedVector() {
+        clear();
+    }
+
+    BasicPagedVector(BasicPagedVector &&other) noexcept
+        : pages_(std::move(other.pages_)), size_(other.size_) {
+        other.pages_.clear();
+        other.size_ = 0;
+    }
+
+    BasicPagedVector &operator=(BasicPagedVector &&other) noexcept {
+        if (this == &other) return *this;
+
+        clear();
+        pages_ = std::move(other.pages_);
+        size_ = other.size_;
+        other.pages_.clear();
+        other.size_ = 0;
+        return *this;
+    }
+
+    BasicPagedVector(const BasicPagedVector &) = delete;
+    BasicPagedVector &operator=(const BasicPagedVector &) = delete;
+
+public:
+    reference operator[](const size_type i) noexcept {
+        assert(i < size_);
+        return *address(i);
+    }
+
+    const_reference operator[](const size_type i) const noexcept {
+        assert(i < size_);
+        return *address(i);
+    }
+
+    reference back() noexcept {
+        return (*this)[size_ - 1];
+    }
+
+    const_reference back() const noexcept {
+        return (*this)[size_ - 1];
+    }
+
+    template<typename... Args>
+    reference emplace_back(Args &&...args) {
+        page_assured();
+        auto *value = ::new (static_cast<void *>(address(size_))) T(std::forward<Args>(args)...);
+        ++size_;
+        return *value;
+    }
+
+    void push_back(const value_type &value) {
+        emplace_back(value);
+    }
+
+    void push_back(value_type &&value) {
+        emplace_back(std::move(value));
+    }
+
+    void pop_back() noexcept {
+        assert(size_ > 0);
+        address(--size_)->~T();
+    }
+
+    /**
+     * @brief Replaces the elements with the copies of a range.
+     *
+     * The elements are copied a page at a time, so the trivially copyable
+     * types are copied in blocks.
+     */
+    template<typename It>
+    void assign(It first, It last) {
+        clear();
+        const auto count = static_cast<size_type>(std::distance(first, last));
+        reserve(count);
+
+        while (size_ < count) {
+            const auto n = (std::min)(count - size_, PAGE_SIZE - pos_in_page(size_));
+            std::uninitialized_copy_n(first, n, address(size_));
+            std::advance(first, n);
+            size_ += n;
+        }
+    }
+
+    /**
+     * @brief Destroys all the elements. The pages are kept.
+     */
+    void clear() noexcept {
+        while (size_ > 0) pop_back();
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    size_type capacity() const noexcept {
+        return pages_.size() * PAGE_SIZE;
+    }
+
+    /**
+     * @brief Allocates the pages needed to hold n elements.
+     */
+    void reserve(const size_type n) {
+        const auto page_count = (n + PAGE_SIZE - 1) / PAGE_SIZE;
+        if (!(pages_.size() < page_count)) return;
+
+        pages_.reserve(page_count);
+        while (pages_.size() < page_count) {
+            pages_.emplace_back(new Storage[PAGE_SIZE]);
+        }
+    }
+
+    /**
+     * @brief Releases the pages not needed by the elements.
+     */
+    void shrink_to_fit() {
+        const auto page_count = (size_ + PAGE_SIZE - 1) / PAGE_SIZE;
+        if (pages_.size() > page_count) pages_.resize(page_count);
+        pages_.shrink_to_fit();
+    }
+
+    /**
+     * @brief Returns the first element of a page. The elements of a page are contiguous.
+     */
+    const T *page_data(const size_type page) const noexcept {
+        assert(page < pages_.size());
+        return reinterpret_cast<const T *>(pages_[page].get());
+    }
+
+    /**
+     * @brief Returns the number of the allocated pages.
+     */
+    size_type page_count() const noexcept {
+        return pages_.size();
+    }
+
+private:
+    std::vector<std::unique_ptr<Storage[]>> pages_;
+    size_type size_{0};
+};
+
+} // namespace containers
+} // namespace nodec
+
+#endif
@@ -3,7 +3,10 @@
 
 #include "../utility.hpp"
 
+#include <algorithm>
+#include <bitset>
 #include <cassert>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -21,6 +24,22 @@ namespace containers {
  */
 constexpr std::uint16_t DEFAULT_SPARSE_GROUP_SIZE = 48;
 
+namespace internal {
+
+/**
+ * @brief Counts the set bits of a 64 bits word.
+ * @note Waiting for C++20 (and std::popcount).
+ */
+inline int popcount64(const std::uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(value);
+#else
+    return static_cast<int>(std::bitset<64>(value).count());
+#endif
+}
+
+} // namespace internal
+
 template<typename Value, std::uint16_t GROUP_SIZE>
 class BasicSparseGroup {
 public:
@@ -28,116 +47,169 @@ public:
     using size_type = std::uint16_t;
 
 private:
-    /**
-     * @brief i bits to bytes (rounded down)
-     */
-    static size_type bit_to_byte(size_type i) {
-        return i >> 3;
+    using Word = std::uint64_t;
+    using Allocator = std::allocator<value_type>;
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+
+    static constexpr size_type WORD_BITS = 64;
+    static constexpr size_type WORD_COUNT = (GROUP_SIZE - 1) / WORD_BITS + 1; // fancy math is so we round up
+
+    static size_type word_index(size_type i) noexcept {
+        return i / WORD_BITS;
     }
 
-    /**
-     * @brief Gets the leftover bits with division by byte.
-     */
-    static size_type mod_bit(size_type i) {
-        return 1 << (i & 0x07);
-    }
-
-    static size_type bits_in_byte(uint8_t byte) {
-        // clang-format off
-        static const uint8_t bits_in[256] = {
-            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
-            1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
-            1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
-            2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
-            1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
-            2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
-            2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
-            3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
-            1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
-            2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
-            2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
-            3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
-            2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
-            3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
-            3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
-            4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8,
-        };
-        // clang-format on
-        return bits_in[byte];
+    static Word bit_mask(size_type i) noexcept {
+        return Word{1} << (i % WORD_BITS);
     }
 
     /*
-     * @brief We need a small function that tells us how many set bits there are
-     *   in position 0..i-1 of the bitmap.
+     * @brief Tells us how many set bits there are in position 0..i-1 of the bitmap.
      */
-    static size_type pos_to_offset(const uint8_t *bm, size_type pos) {
+    size_type pos_to_offset(size_type pos) const noexcept {
         size_type retval = 0;
+        const auto *word = bitmap_;
 
-        // @note Condition pos > 8 is an optimization; convince yourself we
-        // give exactly the same result as if we had pos >= 8 here instead.
-        for (; pos > 8; pos -= 8) {
-            retval += bits_in_byte(*bm++);
+        for (; pos >= WORD_BITS; pos -= WORD_BITS) {
+            retval += static_cast<size_type>(internal::popcount64(*word++));
         }
-        return retval + bits_in_byte(*bm & ((1 << pos) - 1));
+        return retval + static_cast<size_type>(internal::popcount64(*word & (bit_mask(pos) - 1)));
     }
 
     /**
      * @brief Tests bucket i is occurred or not.
      */
-    int bm_test(size_type i) const {
-        return bitmap_[bit_to_byte(i)] & mod_bit(i);
+    bool bm_test(size_type i) const noexcept {
+        return (bitmap_[word_index(i)] & bit_mask(i)) != 0;
     }
 
-    void bm_set(size_type i) {
-        bitmap_[bit_to_byte(i)] |= mod_bit(i);
+    void bm_set(size_type i) noexcept {
+        bitmap_[word_index(i)] |= bit_mask(i);
     }
 
-    void bm_clear(size_type i) {
-        bitmap_[bit_to_byte(i)] &= ~mod_bit(i);
+    void bm_clear(size_type i) noexcept {
+        bitmap_[word_index(i)] &= ~bit_mask(i);
+    }
+
+    /**
+     * @brief Moves the buckets to a new allocation of the given capacity.
+     */
+    void reallocate(const size_type new_capacity) {
+        Allocator allocator;
+        value_type *buckets = new_capacity ? AllocatorTraits::allocate(allocator, new_capacity) : nullptr;
+
+        for (size_type i = 0; i < num_buckets_; ++i) {
+            AllocatorTraits::construct(allocator, buckets + i, std::move(buckets_[i]));
+        }
+
+        const auto count = num_buckets_;
+        release();
+        buckets_ = buckets;
+        num_buckets_ = count;
+        capacity_ = new_capacity;
+    }
+
+    void release() noexcept {
+        if (!buckets_) return;
+
+        Allocator allocator;
+        for (size_type i = 0; i < num_buckets_; ++i) {
+            AllocatorTraits::destroy(allocator, buckets_ + i);
+        }
+        AllocatorTraits::deallocate(allocator, buckets_, capacity_);
+        buckets_ = nullptr;
+        num_buckets_ = 0;
+        capacity_ = 0;
     }
 
 public:
-    BasicSparseGroup() {
-        buckets_.reserve(GROUP_SIZE);
+    BasicSparseGroup() {}
+
+    ~BasicSparseGroup() {
+        release();
     }
-    ~BasicSparseGroup() {}
 
-    bool contains(const size_type i) const {
-        return bm_test(i) != 0x00;
+    BasicSparseGroup(BasicSparseGroup &&other) noexcept {
+        *this = std::move(other);
+    }
+
+    BasicSparseGroup &operator=(BasicSparseGroup &&other) noexcept {
+        if (this == &other) return *this;
+
+        release();
+        std::copy(std::begin(other.bitmap_), std::end(other.bitmap_), std::begin(bitmap_));
+        std::fill(std::begin(other.bitmap_), std::end(other.bitmap_), Word{0});
+        buckets_ = other.buckets_;
+        num_buckets_ = other.num_buckets_;
+        capacity_ = other.capacity_;
+        other.buckets_ = nullptr;
+        other.num_buckets_ = 0;
+        other.capacity_ = 0;
+        return *this;
+    }
+
+    BasicSparseGroup(const BasicSparseGroup &) = delete;
+    BasicSparseGroup &operator=(const BasicSparseGroup &) = delete;
+
+    bool contains(const size_type i) const noexcept {
+        return bm_test(i);
     }
 
     template<typename... Args>
     std::pair<value_type &, bool> emplace(const size_type i, Args &&...args) {
+        const auto offset = pos_to_offset(i);
         if (bm_test(i)) {
-            return {buckets_[pos_to_offset(bitmap_, i)], false};
+            return {buckets_[offset], false};
+        }
+
+        // Construct the new value first, args may refer to an existing bucket.
+        value_type value(std::forward<Args>(args)...);
+
+        if (num_buckets_ == capacity_) {
+            // Grow in powers of two up to the group size, so that sparse groups stay small.
+            reallocate((std::min)(static_cast<size_type>(capacity_ ? capacity_ * 2 : 1), GROUP_SIZE));
         }
 
-        const auto offset = pos_to_offset(bitmap_, i);
-        buckets_.emplace(buckets_.begin() + offset, std::forward<Args>(args)...);
+        Allocator allocator;
+        if (offset == num_buckets_) {
+            AllocatorTraits::construct(allocator, buckets_ + offset, std::move(value));
+        } else {
+            AllocatorTraits::construct(allocator, buckets_ + num_buckets_, std::move(buckets_[num_buckets_ - 1]));
+            std::move_backward(buckets_ + offset, buckets_ + num_buckets_ - 1, buckets_ + num_buckets_);
+            buckets_[offset] = std::move(value);
+        }
+        ++num_buckets_;
 
         bm_set(i);
 
         return {buckets_[offset], true};
     }
 
-    const value_type *try_get(const size_type i) const {
+    const value_type *try_get(const size_type i) const noexcept {
         if (!bm_test(i)) return nullptr;
 
-        return &buckets_[pos_to_offset(bitmap_, i)];
+        return buckets_ + pos_to_offset(i);
     }
 
-    value_type *try_get(const size_type i) {
-        if (!bm_test(i)) return nullptr;
-
-        return &buckets_[pos_to_offset(bitmap_, i)];
+    value_type *try_get(const size_type i) noexcept {
+        return const_cast<value_type *>(nodec::as_const(*this).try_get(i));
     }
 
     bool erase(const size_type i) {
         if (!bm_test(i)) return false;
 
-        auto offset = pos_to_offset(bitmap_, i);
-        buckets_.erase(buckets_.begin() + offset);
+        const auto offset = pos_to_offset(i);
+        std::move(buckets_ + offset + 1, buckets_ + num_buckets_, buckets_ + offset);
+
+        Allocator allocator;
+        AllocatorTraits::destroy(allocator, buckets_ + num_buckets_ - 1);
+        --num_buckets_;
         bm_clear(i);
+
+        if (num_buckets_ == 0) {
+            release();
+        } else if (num_buckets_ <= capacity_ / 4) {
+            reallocate(capacity_ / 2);
+        }
         return true;
     }
 
@@ -145,16 +217,31 @@ public:
      * @brief Returns the number of actually existing buckets.
      */
     size_type bucket_count() const noexcept {
-        return buckets_.capacity();
+        return capacity_;
+    }
+
+    bool empty() const noexcept {
+        return num_buckets_ == 0;
+    }
+
+    /**
+     * @brief Reallocates the buckets to fit the elements.
+     */
+    void shrink_to_fit() {
+        if (num_buckets_ == 0) {
+            release();
+        } else if (num_buckets_ < capacity_) {
+            reallocate(num_buckets_);
+        }
     }
 
 private:
-    std::vector<value_type> buckets_;
-    std::uint8_t bitmap_[(GROUP_SIZE - 1) / 8 + 1]{}; // fancy math is so we round up
+    Word bitmap_[WORD_COUNT]{};
 
-    // NOTE: Consider to save the next group index.
-    //  To iterate the values.
-    // size_type next_group_;
+    //! The buckets grow in powers of two, so that sparse groups stay small.
+    value_type *buckets_{nullptr};
+    size_type num_buckets_{0};
+    size_type capacity_{0};
 };
 
 template<typename T, uint16_t GROUP_SIZE>
@@ -187,23 +274,18 @@ private:
             groups_.resize(index + 1);
         }
 
-        auto &group = groups_[index];
-        if (group) return group.get();
-
-        group.reset(new Group());
-        return group.get();
+        return &groups_[index];
     }
 
     const Group *group_if_exists(size_type i) const {
         const auto index = group_index(i);
         if (!(index < groups_.size())) return nullptr;
-        auto &group = groups_[index];
 
-        return groups_[index].get();
+        return &groups_[index];
     }
 
     Group *group_if_exists(size_type i) {
-        return const_cast<Group *>(as_const(*this).group_if_exists(i));
+        return const_cast<Group *>(nodec::as_const(*this).group_if_exists(i));
     }
 
 public:
@@ -240,8 +322,57 @@ public:
         return group->contains(pos_in_group(i));
     }
 
+    /**
+     * @brief Allocates the groups needed to hold the elements in [0, n).
+     */
+    void reserve(const size_type n) {
+        if (n == 0) return;
+
+        const auto count = group_index(n - 1) + 1;
+        if (groups_.size() < count) groups_.resize(count);
+    }
+
+    /**
+     * @brief Returns the number of actually existing buckets in all the groups.
+     */
+    size_type bucket_count() const noexcept {
+        size_type count = 0;
+        for (const auto &group : groups_) {
+            count += group.bucket_count();
+        }
+        return count;
+    }
+
+    /**
+     * @brief Returns the number of the elements the allocated buckets can hold.
+     */
+    size_type capacity() const noexcept {
+        return bucket_count();
+    }
+
+    /**
+     * @brief Returns the bytes allocated for the groups and their buckets.
+     */
+    size_type memory_usage() const noexcept {
+        return groups_.capacity() * sizeof(Group) + bucket_count() * sizeof(value_type);
+    }
+
+    /**
+     * @brief Fits the buckets of each group to its elements, and trims the trailing empty groups.
+     */
+    void shrink_to_fit() {
+        for (auto &group : groups_) {
+            group.shrink_to_fit();
+        }
+
+        while (!groups_.empty() && groups_.back().empty()) groups_.pop_back();
+        groups_.shrink_to_fit();
+    }
+
 private:
-    std::vector<std::unique_ptr<Group>> groups_;
+    //! The groups are held in one contiguous slab.
+    //! Only the buckets of non-empty groups are allocated separately.
+    std::vector<Group> groups_;
 };
 
 template<typename T>
@@ -0,0 +1,257 @@
+#ifndef NODEC__DELEGATE_HPP_
+#define NODEC__DELEGATE_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace nodec {
+
+template<typename>
+class Delegate;
+
+/**
+ * @brief Type-erased callable which keeps small callables in a fixed inline buffer.
+ *
+ * A callable is stored inline, without allocation, if it fits in the buffer and
+ * is trivially copyable, like function pointers and the lambdas capturing a few
+ * references or pointers. The other callables are allocated on the heap, like
+ * std::function does.
+ *
+ * The free functions and the member functions known at compile time are bound
+ * with bind(), which stores at most the instance pointer:
+ *
+ * @code{.cpp}
+ * auto on_update = Delegate<void(float)>::bind<&update>();
+ * auto on_resize = Delegate<void(int, int)>::bind<&Window::resize>(&window);
+ * @endcode
+ *
+ * The storage is trivially relocatable in both cases, so moving a delegate only
+ * copies its bytes.
+ */
+template<typename R, typename... Args>
+class Delegate<R(Args...)> {
+public:
+    //! The size of the inline buffer. A lambda capturing two references fits in it.
+    static constexpr std::size_t buffer_size = 2 * sizeof(void *);
+
+private:
+    struct Storage {
+        alignas(void *) unsigned char bytes[buffer_size];
+    };
+
+    using Invoker = R (*)(Storage &, Args...);
+
+    //! Copies the heap callable of src into dst, or destroys the one of dst if src is null.
+    using Manager = void (*)(Storage &dst, const Storage *src);
+
+    template<typename Functor>
+    static constexpr bool stored_inline = sizeof(Functor) <= buffer_size
+                                          && alignof(Functor) <= alignof(void *)
+                                          && std::is_trivially_copyable<Functor>::value
+                                          && std::is_trivially_destructible<Functor>::value;
+
+    template<typename Functor>
+    static Functor &inline_functor(Storage &storage) noexcept {
+        return *std::launder(reinterpret_cast<Functor *>(storage.bytes));
+    }
+
+    template<typename Functor>
+    static Functor *&heap_functor(Storage &storage) noexcept {
+        return *std::launder(reinterpret_cast<Functor **>(storage.bytes));
+    }
+
+    template<typename Functor>
+    static Functor *heap_functor(const Storage &storage) noexcept {
+        return *std::launder(reinterpret_cast<Functor *const *>(storage.bytes));
+    }
+
+    template<typename Callable, typename... Params>
+    static R call(Callable &&callable, Params &&...params) {
+        if constexpr (std::is_void<R>::value) {
+            std::invoke(std::forward<Callable>(callable), std::forward<Params>(params)...);
+        } else {
+            return std::invoke(std::forward<Callable>(callable), std::forward<Params>(params)...);
+        }
+    }
+
+    template<typename Functor>
+    static R invoke_inline(Storage &storage, Args... args) {
+        return call(inline_functor<Functor>(storage), std::forward<Args>(args)...);
+    }
+
+    template<typename Functor>
+    static R invoke_heap(Storage &storage, Args... args) {
+        return call(*heap_functor<Functor>(storage), std::forward<Args>(args)...);
+    }
+
+    template<typename Functor>
+    static void manage_heap(Storage &dst, const Storage *src) {
+        if (src) {
+            heap_functor<Functor>(dst) = new Functor(*heap_functor<Functor>(*src));
+        } else {
+            delete heap_functor<Functor>(dst);
+        }
+    }
+
+    template<auto Candidate>
+    static R invoke_function(Storage &, Args... args) {
+        return call(Candidate, std::forward<Args>(args)...);
+    }
+
+    template<auto Candidate, typename Type>
+    static R invoke_member(Storage &storage, Args... args) {
+        return call(Candidate, inline_functor<Type *>(storage), std::forward<Args>(args)...);
+    }
+
+    template<typename Functor>
+    using enable_if_callable = std::enable_if_t<!std::is_same<std::decay_t<Functor>, Delegate>::value
+                                                && !std::is_same<std::decay_t<Functor>, std::nullptr_t>::value
+                                                && std::is_invocable_r<R, std::decay_t<Functor> &, Args...>::value>;
+
+public:
+    Delegate() noexcept = default;
+
+    Delegate(std::nullptr_t) noexcept {}
+
+    template<typename Functor, typename = enable_if_callable<Functor>>
+    Delegate(Functor &&functor) {
+        using Type = std::decay_t<Functor>;
+
+        // A function reference decays to a pointer, but it is never null.
+        using Passed = std::remove_reference_t<Functor>;
+        if constexpr (std::is_pointer<Passed>::value || std::is_member_pointer<Passed>::value) {
+            if (functor == nullptr) return;
+        }
+
+        if constexpr (stored_inline<Type>) {
+            ::new (static_cast<void *>(storage_.bytes)) Type(std::forward<Functor>(functor));
+            invoke_ = &invoke_inline<Type>;
+        } else {
+            static_assert(std::is_copy_constructible<Type>::value, "The callable must be copy constructible.");
+            heap_functor<Type>(storage_) = new Type(std::forward<Functor>(functor));
+            invoke_ = &invoke_heap<Type>;
+            manage_ = &manage_heap<Type>;
+        }
+    }
+
+    /**
+     * @brief Binds a free function known at compile time.
+     */
+    template<auto Candidate>
+    static Delegate bind() noexcept {
+        Delegate delegate;
+        delegate.invoke_ = &invoke_function<Candidate>;
+        return delegate;
+    }
+
+    /**
+     * @brief Binds a member function known at compile time to an instance.
+     *
+     * Only the instance pointer is stored. The instance must outlive the delegate.
+     */
+    template<auto Candidate, typename Type>
+    static Delegate bind(Type *instance) noexcept {
+        Delegate delegate;
+        ::new (static_cast<void *>(delegate.storage_.bytes)) Type *(instance);
+        delegate.invoke_ = &invoke_member<Candidate, Type>;
+        return delegate;
+    }
+
+    template<auto Candidate, typename Type>
+    static Delegate bind(Type &instance) noexcept {
+        return bind<Candidate>(&instance);
+    }
+
+    Delegate(const Delegate &other)
+        : invoke_{other.invoke_}, manage_{other.manage_} {
+        if (manage_) {
+            manage_(storage_, &other.storage_);
+        } else {
+            std::memcpy(storage_.bytes, other.storage_.bytes, buffer_size);
+        }
+    }
+
+    Delegate(Delegate &&other) noexcept
+        : invoke_{other.invoke_}, manage_{other.manage_} {
+        std::memcpy(storage_.bytes, other.storage_.bytes, buffer_size);
+        other.invoke_ = nullptr;
+        other.manage_ = nullptr;
+    }
+
+    ~Delegate() {
+        reset();
+    }
+
+    Delegate &operator=(const Delegate &other) {
+        if (this != &other) {
+            Delegate copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    Delegate &operator=(Delegate &&other) noexcept {
+        if (this != &other) {
+            reset();
+            std::memcpy(storage_.bytes, other.storage_.bytes, buffer_size);
+            invoke_ = other.invoke_;
+            manage_ = other.manage_;
+            other.invoke_ = nullptr;
+            other.manage_ = nullptr;
+        }
+        return *this;
+    }
+
+    Delegate &operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    /**
+     * @brief Makes the delegate empty.
+     *
+     * The inline buffer is left as is, so a callable may empty its own delegate
+     * while it is running.
+     */
+    void reset() noexcept {
+        if (manage_) manage_(storage_, nullptr);
+        invoke_ = nullptr;
+        manage_ = nullptr;
+    }
+
+    explicit operator bool() const noexcept {
+        return invoke_ != nullptr;
+    }
+
+    /**
+     * @brief Checks if the callable is stored on the heap.
+     */
+    bool allocated() const noexcept {
+        return manage_ != nullptr;
+    }
+
+    R operator()(Args... args) const {
+        return invoke_(storage_, std::forward<Args>(args)...);
+    }
+
+    friend bool operator==(const Delegate &delegate, std::nullptr_t) noexcept {
+        return !delegate;
+    }
+
+    friend bool operator!=(const Delegate &delegate, std::nullptr_t) noexcept {
+        return static_cast<bool>(delegate);
+    }
+
+private:
+    mutable Storage storage_;
+    Invoker invoke_{nullptr};
+    Manager manage_{nullptr};
+};
+
+} // namespace nodec
+
+#endif
@@ -0,0 +1,623 @@
+#ifndef NODEC__ENTITIES__ARCHETYPE_REGISTRY_HPP_
+#define NODEC__ENTITIES__ARCHETYPE_REGISTRY_HPP_
+
+#include "../type_info.hpp"
+#include "entity.hpp"
+#include "exceptions.hpp"
+#include "registry.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace nodec {
+namespace entities {
+
+namespace internal {
+
+/**
+ * @brief Type-erased operations of a component stored in archetype chunks.
+ */
+struct ArchetypeComponentInfo {
+    const type_info *type;
+    type_seq_index_type seq_index;
+    std::size_t size;
+    std::size_t align;
+    void (*move_construct)(void *dst, void *src);
+    void (*destroy)(void *ptr);
+};
+
+template<typename Component>
+const ArchetypeComponentInfo &archetype_component_info() {
+    static_assert(alignof(Component) <= alignof(std::max_align_t), "Over-aligned components are not supported.");
+    static_assert(std::is_move_constructible<Component>::value, "The component must be move constructible.");
+
+    static const ArchetypeComponentInfo info{
+        &type_id<Component>(),
+        type_id<Component>().seq_index(),
+        sizeof(Component),
+        alignof(Component),
+        [](void *dst, void *src) { ::new (dst) Component(std::move(*static_cast<Component *>(src))); },
+        [](void *ptr) { static_cast<Component *>(ptr)->~Component(); }};
+    return info;
+}
+
+/**
+ * @brief Entities sharing the same set of components, stored in fixed-size chunks.
+ *
+ * A chunk is a SoA block: the entity array followed by one array per component,
+ * each with the same number of rows. Rows are kept dense; erasing a row moves
+ * the last row into it.
+ */
+template<typename Entity>
+class Archetype {
+    using Info = ArchetypeComponentInfo;
+    using Block = std::max_align_t;
+
+    static std::size_t align_up(const std::size_t value, const std::size_t align) noexcept {
+        return (value + align - 1) / align * align;
+    }
+
+public:
+    static constexpr std::size_t CHUNK_SIZE = 16 * 1024;
+
+    /**
+     * @param components The components sorted by the seq index.
+     */
+    explicit Archetype(std::vector<const Info *> components)
+        : components_(std::move(components)) {
+        std::size_t row_bytes = sizeof(Entity);
+        for (const auto *info : components_) row_bytes += info->size;
+
+        capacity_ = (std::max)(CHUNK_SIZE / row_bytes, std::size_t{1});
+        offsets_.resize(components_.size());
+        while (true) {
+            auto end = sizeof(Entity) * capacity_;
+            for (std::size_t i = 0; i < components_.size(); ++i) {
+                offsets_[i] = align_up(end, components_[i]->align);
+                end = offsets_[i] + components_[i]->size * capacity_;
+            }
+            chunk_bytes_ = end;
+            if (chunk_bytes_ <= CHUNK_SIZE || capacity_ == 1) break;
+            --capacity_;
+        }
+
+        for (std::size_t i = 0; i < components_.size(); ++i) {
+            const auto seq_index = components_[i]->seq_index;
+            if (!(seq_index < column_of_.size())) column_of_.resize(seq_index + 1, -1);
+            column_of_[seq_index] = static_cast<int>(i);
+        }
+    }
+
+    ~Archetype() {
+        while (size_ > 0) erase_row(size_ - 1);
+    }
+
+    Archetype(const Archetype &) = delete;
+    Archetype &operator=(const Archetype &) = delete;
+
+    const std::vector<const Info *> &components() const noexcept {
+        return components_;
+    }
+
+    /**
+     * @brief Returns the column of the component, or -1.
+     */
+    int column_index(const type_seq_index_type seq_index) const noexcept {
+        return seq_index < column_of_.size() ? column_of_[seq_index] : -1;
+    }
+
+    std::size_t size() const noexcept {
+        return size_;
+    }
+
+    std::size_t chunk_capacity() const noexcept {
+        return capacity_;
+    }
+
+    std::size_t chunk_count() const noexcept {
+        return (size_ + capacity_ - 1) / capacity_;
+    }
+
+    /**
+     * @brief Returns the number of the rows in the chunk.
+     */
+    std::size_t chunk_size(const std::size_t chunk) const noexcept {
+        return (std::min)(capacity_, size_ - chunk * capacity_);
+    }
+
+    Entity *entities(const std::size_t chunk) const noexcept {
+        return reinterpret_cast<Entity *>(chunks_[chunk].get());
+    }
+
+    void *column(const std::size_t chunk, const std::size_t col) const noexcept {
+        return reinterpret_cast<unsigned char *>(chunks_[chunk].get()) + offsets_[col];
+    }
+
+    Entity entity_at(const std::size_t row) const noexcept {
+        return entity_ref(row);
+    }
+
+    void *at(const std::size_t row, const std::size_t col) const noexcept {
+        return static_cast<unsigned char *>(column(row / capacity_, col)) + components_[col]->size * (row % capacity_);
+    }
+
+    /**
+     * @brief Appends a row with the given entity and returns its index.
+     *
+     * The components of the row are not constructed. The caller must construct them.
+     */
+    std::size_t push(const Entity entity) {
+        const auto chunk = size_ / capacity_;
+        if (!(chunk < chunks_.size())) {
+            chunks_.emplace_back(new Block[(chunk_bytes_ + sizeof(Block) - 1) / sizeof(Block)]);
+        }
+
+        const auto row = size_++;
+        entity_ref(row) = entity;
+        return row;
+    }
+
+    /**
+     * @brief Destroys the components of a row, and moves the last row into it.
+     *
+     * @return The entity moved into the row, or null if the erased row was the last.
+     */
+    Entity erase_row(const std::size_t row) {
+        assert(row < size_);
+        const auto last = size_ - 1;
+
+        for (std::size_t col = 0; col < components_.size(); ++col) {
+            components_[col]->destroy(at(row, col));
+            if (row != last) {
+                components_[col]->move_construct(at(row, col), at(last, col));
+                components_[col]->destroy(at(last, col));
+            }
+        }
+
+        Entity moved = null_entity;
+        if (row != last) {
+            moved = entity_ref(row) = entity_at(last);
+        }
+        --size_;
+
+        // Keep one spare chunk to avoid the thrashing on the boundary.
+        while (chunks_.size() > chunk_count() + 1) chunks_.pop_back();
+        return moved;
+    }
+
+    //! Transitions to the other archetypes by the seq index of a component.
+    std::unordered_map<type_seq_index_type, std::size_t> add_edges;
+    std::unordered_map<type_seq_index_type, std::size_t> remove_edges;
+
+private:
+    Entity &entity_ref(const std::size_t row) const noexcept {
+        return entities(row / capacity_)[row % capacity_];
+    }
+
+    std::vector<const Info *> components_;
+    std::vector<std::size_t> offsets_;
+    std::vector<int> column_of_;
+    std::vector<std::unique_ptr<Block[]>> chunks_;
+    std::size_t capacity_{0};
+    std::size_t chunk_bytes_{0};
+    std::size_t size_{0};
+};
+
+} // namespace internal
+
+template<typename Entity>
+class BasicArchetypeRegistry;
+
+/**
+ * @brief View over the archetypes that have all the given components.
+ *
+ * The iteration walks the chunks of each matching archetype linearly, so the
+ * components of each row are read from parallel arrays.
+ *
+ * The structure of the registry must not be changed during the iteration.
+ */
+template<typename Entity, typename... Components>
+class BasicArchetypeView {
+    using Archetype = internal::Archetype<Entity>;
+
+    template<typename Func, std::size_t... Is>
+    static void each_in(const Archetype &archetype, const std::array<int, sizeof...(Components)> &columns,
+                        Func &func, std::index_sequence<Is...>) {
+        for (std::size_t chunk = 0, count = archetype.chunk_count(); chunk < count; ++chunk) {
+            const auto *entities = archetype.entities(chunk);
+            const auto arrays = std::make_tuple(static_cast<Components *>(archetype.column(chunk, columns[Is]))...);
+
+            for (std::size_t i = 0, size = archetype.chunk_size(chunk); i < size; ++i) {
+                func(entities[i], std::get<Is>(arrays)[i]...);
+            }
+        }
+    }
+
+public:
+    explicit BasicArchetypeView(const std::vector<std::unique_ptr<Archetype>> &archetypes) noexcept
+        : archetypes_{&archetypes} {}
+
+    /**
+     * @brief Iterates the entities and their components.
+     *
+     * @param func void(Entity, Components&...)
+     */
+    template<typename Func>
+    void each(Func func) const {
+        for (const auto &archetype : *archetypes_) {
+            if (archetype->size() == 0) continue;
+
+            const std::array<int, sizeof...(Components)> columns{
+                archetype->column_index(type_id<std::remove_const_t<Components>>().seq_index())...};
+            if (std::any_of(columns.begin(), columns.end(), [](int col) { return col < 0; })) continue;
+
+            each_in(*archetype, columns, func, std::index_sequence_for<Components...>{});
+        }
+    }
+
+    /**
+     * @brief Returns the number of the entities in the view.
+     */
+    std::size_t size() const noexcept {
+        std::size_t count = 0;
+        for (const auto &archetype : *archetypes_) {
+            const std::array<int, sizeof...(Components)> columns{
+                archetype->column_index(type_id<std::remove_const_t<Components>>().seq_index())...};
+            if (std::none_of(columns.begin(), columns.end(), [](int col) { return col < 0; })) {
+                count += archetype->size();
+            }
+        }
+        return count;
+    }
+
+private:
+    const std::vector<std::unique_ptr<Archetype>> *archetypes_;
+};
+
+/**
+ * @brief Registry which groups the entities by their exact set of components (archetype).
+ *
+ * It is an alternative backend to BasicRegistry with the same core surface:
+ * create_entity, destroy_entity, each_entity, emplace_component,
+ * remove_component, remove_all_components, get_component, try_get_component,
+ * all_of, any_of, visit and view<...>().each. It has no signals, groups,
+ * sorting or bulk operations.
+ *
+ * Compared to the sparse sets, iterating several components is a linear walk
+ * over the SoA chunks without any lookup, while adding or removing a component
+ * moves all the components of the entity to another archetype.
+ * Choose the backend at compile time with registry_for_t.
+ *
+ * The references to the components are invalidated by any structural change.
+ *
+ * The registry can be moved. The views made before are invalidated, and the
+ * moved-from registry can only be assigned to or destroyed.
+ */
+template<typename Entity>
+class BasicArchetypeRegistry {
+    using Archetype = internal::Archetype<Entity>;
+    using Info = internal::ArchetypeComponentInfo;
+
+    struct Record {
+        Entity entity;
+        std::size_t archetype;
+        std::size_t row;
+    };
+
+    static constexpr std::size_t EMPTY_ARCHETYPE = 0;
+    static constexpr std::size_t RELEASED = (std::numeric_limits<std::size_t>::max)();
+
+    std::size_t archetype_for(std::vector<const Info *> components) {
+        std::vector<type_seq_index_type> key(components.size());
+        std::transform(components.begin(), components.end(), key.begin(), [](const auto *info) { return info->seq_index; });
+
+        auto iter = archetype_index_.find(key);
+        if (iter != archetype_index_.end()) return iter->second;
+
+        archetypes_.emplace_back(new Archetype(std::move(components)));
+        archetype_index_.emplace(std::move(key), archetypes_.size() - 1);
+        return archetypes_.size() - 1;
+    }
+
+    std::size_t archetype_with(const std::size_t from, const Info &info) {
+        auto &edges = archetypes_[from]->add_edges;
+        auto iter = edges.find(info.seq_index);
+        if (iter != edges.end()) return iter->second;
+
+        auto components = archetypes_[from]->components();
+        components.insert(std::upper_bound(components.begin(), components.end(), &info,
+                                           [](const auto *lhs, const auto *rhs) { return lhs->seq_index < rhs->seq_index; }),
+                          &info);
+        const auto to = archetype_for(std::move(components));
+        archetypes_[from]->add_edges.emplace(info.seq_index, to);
+        return to;
+    }
+
+    std::size_t archetype_without(const std::size_t from, const type_seq_index_type seq_index) {
+        auto &edges = archetypes_[from]->remove_edges;
+        auto iter = edges.find(seq_index);
+        if (iter != edges.end()) return iter->second;
+
+        auto components = archetypes_[from]->components();
+        components.erase(std::find_if(components.begin(), components.end(),
+                                      [&](const auto *info) { return info->seq_index == seq_index; }));
+        const auto to = archetype_for(std::move(components));
+        archetypes_[from]->remove_edges.emplace(seq_index, to);
+        return to;
+    }
+
+    /**
+     * @brief Moves an entity to another archetype with the shared components.
+     *
+     * The components only in the destination are left unconstructed.
+     */
+    void move_entity(Record &record, const std::size_t to) {
+        auto &src = *archetypes_[record.archetype];
+        auto &dst = *archetypes_[to];
+
+        const auto row = dst.push(record.entity);
+        const auto &components = dst.components();
+        for (std::size_t col = 0; col < components.size(); ++col) {
+            const auto src_col = src.column_index(components[col]->seq_index);
+            if (src_col < 0) continue;
+            components[col]->move_construct(dst.at(row, col), src.at(record.row, static_cast<std::size_t>(src_col)));
+        }
+
+        erase_row(record);
+        record.archetype = to;
+        record.row = row;
+    }
+
+    void erase_row(const Record &record) {
+        const auto moved = archetypes_[record.archetype]->erase_row(record.row);
+        if (moved != null_entity) {
+            records_[entity_traits_type::to_entity(moved)].row = record.row;
+        }
+    }
+
+    Record &record_of(const Entity entity) {
+        if (!is_valid(entity)) {
+            throw_invalid_entity_exception(entity, __FILE__, __LINE__);
+        }
+        return records_[entity_traits_type::to_entity(entity)];
+    }
+
+    template<typename Component>
+    Component *find(const Entity entity) const {
+        if (!is_valid(entity)) return nullptr;
+
+        const auto &record = records_[entity_traits_type::to_entity(entity)];
+        const auto &archetype = *archetypes_[record.archetype];
+        const auto col = archetype.column_index(type_id<std::remove_const_t<Component>>().seq_index());
+        return col < 0 ? nullptr : static_cast<Component *>(archetype.at(record.row, static_cast<std::size_t>(col)));
+    }
+
+public:
+    using entity_traits_type = entity_traits<Entity>;
+    using entity_type = Entity;
+
+    BasicArchetypeRegistry() {
+        archetype_for({});
+    }
+
+    BasicArchetypeRegistry(BasicArchetypeRegistry &&) = default;
+    BasicArchetypeRegistry &operator=(BasicArchetypeRegistry &&) = default;
+
+    BasicArchetypeRegistry(const BasicArchetypeRegistry &) = delete;
+    BasicArchetypeRegistry &operator=(const BasicArchetypeRegistry &) = delete;
+
+    bool is_valid(const Entity entity) const noexcept {
+        const auto pos = static_cast<std::size_t>(entity_traits_type::to_entity(entity));
+        return pos < records_.size() && records_[pos].entity == entity && records_[pos].archetype != RELEASED;
+    }
+
+    Entity create_entity() {
+        if (!free_numbers_.empty()) {
+            const auto number = free_numbers_.back();
+            free_numbers_.pop_back();
+
+            auto &record = records_[number];
+            record.archetype = EMPTY_ARCHETYPE;
+            record.row = archetypes_[EMPTY_ARCHETYPE]->push(record.entity);
+            return record.entity;
+        }
+
+        const auto number = records_.size();
+        assert(number < entity_traits_type::entity_mask && "No entities available");
+        const auto entity = entity_traits_type::construct(static_cast<typename entity_traits_type::entity_type>(number), 0);
+        records_.push_back({entity, EMPTY_ARCHETYPE, archetypes_[EMPTY_ARCHETYPE]->push(entity)});
+        return entity;
+    }
+
+    void destroy_entity(const Entity entity) {
+        auto &record = record_of(entity);
+        erase_row(record);
+
+        // Keep the next version in the released record; it is not valid until recycled.
+        auto version = static_cast<typename entity_traits_type::version_type>(entity_traits_type::to_version(entity) + 1u);
+        version += (version == entity_traits_type::to_version(tombstone_entity));
+        record.entity = entity_traits_type::construct(entity_traits_type::to_entity(entity), version);
+        record.archetype = RELEASED;
+        free_numbers_.push_back(static_cast<std::size_t>(entity_traits_type::to_entity(entity)));
+    }
+
+    /**
+     * @brief Iterates all the entities that are still in use, the newest first like BasicRegistry.
+     *
+     * @param func void(const Entity)
+     */
+    template<typename Func>
+    void each_entity(Func func) const {
+        for (auto pos = records_.size(); pos; --pos) {
+            const auto &record = records_[pos - 1];
+            if (record.archetype != RELEASED) func(record.entity);
+        }
+    }
+
+    template<typename Component, typename... Args>
+    std::pair<Component &, bool> emplace_component(const Entity entity, Args &&...args) {
+        auto &record = record_of(entity);
+        if (auto *component = find<Component>(entity)) {
+            return {*component, false};
+        }
+
+        // Construct first, so that the registry is left untouched if it throws.
+        Component value{std::forward<Args>(args)...};
+
+        const auto &info = internal::archetype_component_info<Component>();
+        move_entity(record, archetype_with(record.archetype, info));
+
+        const auto &archetype = *archetypes_[record.archetype];
+        auto *ptr = archetype.at(record.row, static_cast<std::size_t>(archetype.column_index(info.seq_index)));
+        return {*::new (ptr) Component(std::move(value)), true};
+    }
+
+    template<typename Component>
+    bool remove_component(const Entity entity) {
+        if (!find<Component>(entity)) return false;
+
+        auto &record = records_[entity_traits_type::to_entity(entity)];
+        move_entity(record, archetype_without(record.archetype, type_id<Component>().seq_index()));
+        return true;
+    }
+
+    /**
+     * @brief Removes all the components of an entity. The entity is kept.
+     */
+    void remove_all_components(const Entity entity) {
+        if (!is_valid(entity)) return;
+
+        auto &record = records_[entity_traits_type::to_entity(entity)];
+        if (record.archetype == EMPTY_ARCHETYPE) return;
+        move_entity(record, EMPTY_ARCHETYPE);
+    }
+
+    template<typename Component>
+    Component &get_component(const Entity entity) {
+        auto *component = find<Component>(entity);
+        if (!component) {
+            if (!is_valid(entity)) throw_invalid_entity_exception(entity, __FILE__, __LINE__);
+            throw_no_component_exception<Component>(entity, __FILE__, __LINE__);
+        }
+        return *component;
+    }
+
+    template<typename Component>
+    const Component &get_component(const Entity entity) const {
+        return const_cast<BasicArchetypeRegistry *>(this)->template get_component<Component>(entity);
+    }
+
+    template<typename Component>
+    Component *try_get_component(const Entity entity) {
+        return find<Component>(entity);
+    }
+
+    template<typename Component>
+    const Component *try_get_component(const Entity entity) const {
+        return find<Component>(entity);
+    }
+
+    template<typename... Components>
+    bool all_of(const Entity entity) const {
+        std::array<bool, sizeof...(Components)> values{(find<Components>(entity) != nullptr)...};
+        return std::all_of(values.cbegin(), values.cend(), [](auto value) { return value; });
+    }
+
+    template<typename... Components>
+    bool any_of(const Entity entity) const {
+        std::array<bool, sizeof...(Components)> values{(find<Components>(entity) != nullptr)...};
+        return std::any_of(values.cbegin(), values.cend(), [](auto value) { return value; });
+    }
+
+    /**
+     * @brief Visits an entity and returns the type info and opaque pointer for its components.
+     *
+     * @param func void(const type_info &, void *component)
+     */
+    template<typename Func>
+    void visit(const Entity entity, Func func) const {
+        if (!is_valid(entity)) return;
+
+        const auto &record = records_[entity_traits_type::to_entity(entity)];
+        const auto &archetype = *archetypes_[record.archetype];
+        const auto &components = archetype.components();
+        for (std::size_t col = 0; col < components.size(); ++col) {
+            func(*components[col]->type, archetype.at(record.row, col));
+        }
+    }
+
+    /**
+     * @brief Returns a view for the given components.
+     */
+    template<typename... Components>
+    BasicArchetypeView<Entity, Components...> view() {
+        static_assert(sizeof...(Components) > 0, "Must provide one or more component types");
+        return BasicArchetypeView<Entity, Components...>{archetypes_};
+    }
+
+    template<typename... Components>
+    BasicArchetypeView<Entity, const Components...> view() const {
+        static_assert(sizeof...(Components) > 0, "Must provide one or more component types");
+        return BasicArchetypeView<Entity, const Components...>{archetypes_};
+    }
+
+    /**
+     * @brief Returns the number of the archetypes created so far, including the empty one.
+     */
+    std::size_t archetype_count() const noexcept {
+        return archetypes_.size();
+    }
+
+private:
+    std::vector<std::unique_ptr<Archetype>> archetypes_;
+    std::map<std::vector<type_seq_index_type>, std::size_t> archetype_index_;
+    std::vector<Record> records_;
+    std::vector<std::size_t> free_numbers_;
+};
+
+using ArchetypeRegistry = BasicArchetypeRegistry<Entity>;
+
+/**
+ * @brief Tag to select the sparse set backend (BasicRegistry).
+ */
+struct SparseSetBackend {};
+
+/**
+ * @brief Tag to select the archetype backend (BasicArchetypeRegistry).
+ */
+struct ArchetypeBackend {};
+
+template<typename Entity, typename Backend>
+struct registry_for;
+
+template<typename Entity>
+struct registry_for<Entity, SparseSetBackend> {
+    using type = BasicRegistry<Entity>;
+};
+
+template<typename Entity>
+struct registry_for<Entity, ArchetypeBackend> {
+    using type = BasicArchetypeRegistry<Entity>;
+};
+
+/**
+ * @brief Registry type for the given backend, selected at compile time.
+ */
+template<typename Entity, typename Backend>
+using registry_for_t = typename registry_for<Entity, Backend>::type;
+
+} // namespace entities
+} // namespace nodec
+
+#endif
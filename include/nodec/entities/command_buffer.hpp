@@ -0,0 +1,305 @@
+#ifndef NODEC__ENTITIES__COMMAND_BUFFER_HPP_
+#define NODEC__ENTITIES__COMMAND_BUFFER_HPP_
+
+#include "../formatter.hpp"
+#include "../type_info.hpp"
+#include "entity.hpp"
+#include "registry.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace nodec {
+namespace entities {
+
+namespace internal {
+
+template<typename Entity>
+class BaseCommandQueue {
+public:
+    virtual ~BaseCommandQueue() {}
+
+    virtual void emplace_next(BasicRegistry<Entity> &registry, const Entity entity) = 0;
+    virtual void skip_next() = 0;
+    virtual void remove(BasicRegistry<Entity> &registry, const Entity entity) = 0;
+    virtual void clear() = 0;
+};
+
+template<typename Entity, typename Component>
+class CommandQueue final : public BaseCommandQueue<Entity> {
+public:
+    template<typename... Args>
+    void push(Args &&...args) {
+        values_.push_back({std::forward<Args>(args)...});
+    }
+
+    void emplace_next(BasicRegistry<Entity> &registry, const Entity entity) override {
+        auto &value = values_[next_++];
+        auto result = registry.template emplace_component<Component>(entity, std::move(value));
+        if (!result.second) {
+            result.first = std::move(value);
+        }
+    }
+
+    void skip_next() override {
+        ++next_;
+    }
+
+    void remove(BasicRegistry<Entity> &registry, const Entity entity) override {
+        registry.template remove_component<Component>(entity);
+    }
+
+    void clear() override {
+        values_.clear();
+        next_ = 0;
+    }
+
+private:
+    std::vector<Component> values_;
+    std::size_t next_{0};
+};
+
+} // namespace internal
+
+/**
+ * @brief Records structural changes to be applied to a registry later.
+ *
+ * A command buffer has a single writer. Worker threads record into their own
+ * buffers without any synchronization, then the owner of the registry applies
+ * them with playback() on its thread. See BasicCommandBuffers to hand out one
+ * buffer per thread.
+ *
+ * create_entity() returns a placeholder entity, which is valid only in the
+ * commands of the same buffer. Placeholders use the tombstone version, so they
+ * never collide with the entities of the registry. On playback, all the
+ * placeholders are created at once and replaced with the actual entities.
+ *
+ * Commands are applied in the order they were recorded. Commands for entities
+ * that are no longer valid at playback (e.g. destroyed by another buffer) are
+ * skipped.
+ */
+template<typename Entity>
+class BasicCommandBuffer {
+    using entity_traits_type = entity_traits<Entity>;
+    using Registry = BasicRegistry<Entity>;
+    using BaseQueue = internal::BaseCommandQueue<Entity>;
+
+    template<typename Component>
+    using Queue = internal::CommandQueue<Entity, Component>;
+
+    enum class CommandType {
+        destroy_entity,
+        emplace_component,
+        remove_component
+    };
+
+    struct Command {
+        CommandType type;
+        Entity entity;
+        BaseQueue *queue;
+    };
+
+    static constexpr auto placeholder_version = entity_traits_type::to_version(tombstone_entity);
+
+    template<typename Component>
+    Queue<Component> *queue_assured() {
+        static_assert(std::is_same<Component, std::decay_t<Component>>::value, "Non-decayed types (s.t. array) not allowed");
+        const auto index = type_id<Component>().seq_index();
+
+        if (!(index < queues_.size())) {
+            queues_.resize(index + 1u);
+        }
+
+        auto &queue = queues_[index];
+        if (!queue) {
+            queue.reset(new Queue<Component>());
+        }
+        return static_cast<Queue<Component> *>(queue.get());
+    }
+
+    Entity resolve(const Entity entity) const noexcept {
+        return is_placeholder(entity) ? created_[entity_traits_type::to_entity(entity)] : entity;
+    }
+
+public:
+    BasicCommandBuffer() = default;
+
+    BasicCommandBuffer(BasicCommandBuffer &&) = default;
+    BasicCommandBuffer &operator=(BasicCommandBuffer &&) = default;
+
+    BasicCommandBuffer(const BasicCommandBuffer &) = delete;
+    BasicCommandBuffer &operator=(const BasicCommandBuffer &) = delete;
+
+    /**
+     * @brief Checks if an entity is a placeholder returned by create_entity().
+     */
+    static bool is_placeholder(const Entity entity) noexcept {
+        return entity != null_entity && entity_traits_type::to_version(entity) == placeholder_version;
+    }
+
+    /**
+     * @brief Records the creation of an entity and returns its placeholder.
+     */
+    Entity create_entity() {
+        const auto number = static_cast<typename entity_traits_type::entity_type>(placeholder_count_++);
+        assert(number < entity_traits_type::entity_mask);
+        return entity_traits_type::construct(number, placeholder_version);
+    }
+
+    void destroy_entity(const Entity entity) {
+        commands_.push_back({CommandType::destroy_entity, entity, nullptr});
+    }
+
+    /**
+     * @brief Records the construction of a component.
+     *
+     * If the entity already has the component at playback, it is replaced.
+     */
+    template<typename Component, typename... Args>
+    void emplace_component(const Entity entity, Args &&...args) {
+        auto *queue = queue_assured<Component>();
+        queue->push(std::forward<Args>(args)...);
+        commands_.push_back({CommandType::emplace_component, entity, queue});
+    }
+
+    template<typename Component>
+    void remove_component(const Entity entity) {
+        commands_.push_back({CommandType::remove_component, entity, queue_assured<Component>()});
+    }
+
+    bool empty() const noexcept {
+        return commands_.empty() && placeholder_count_ == 0;
+    }
+
+    /**
+     * @brief Applies the recorded commands to the registry, then clears the buffer.
+     *
+     * This must be called on the thread which owns the registry, while no one
+     * records into this buffer.
+     */
+    void playback(Registry &registry) {
+        created_.resize(placeholder_count_);
+        registry.create_entities(created_.begin(), created_.end());
+
+        for (const auto &command : commands_) {
+            const auto entity = resolve(command.entity);
+            const bool valid = registry.is_valid(entity);
+
+            switch (command.type) {
+            case CommandType::destroy_entity:
+                if (valid) registry.destroy_entity(entity);
+                break;
+
+            case CommandType::emplace_component:
+                // The value must be consumed to keep the queue in order.
+                if (valid) {
+                    command.queue->emplace_next(registry, entity);
+                } else {
+                    command.queue->skip_next();
+                }
+                break;
+
+            case CommandType::remove_component:
+                if (valid) command.queue->remove(registry, entity);
+                break;
+            }
+        }
+
+        clear();
+    }
+
+    /**
+     * @brief Discards the recorded commands.
+     *
+     * The allocated memory is kept for reuse.
+     */
+    void clear() {
+        commands_.clear();
+        for (auto &queue : queues_) {
+            if (queue) queue->clear();
+        }
+        created_.clear();
+        placeholder_count_ = 0;
+    }
+
+private:
+    std::vector<Command> commands_;
+    std::vector<std::unique_ptr<BaseQueue>> queues_;
+    std::vector<Entity> created_;
+    std::size_t placeholder_count_{0};
+};
+
+/**
+ * @brief Hands out one command buffer per thread.
+ *
+ * Each thread gets its own buffer on its first call of local(). The slots are
+ * claimed with a compare-and-swap, so recording never takes a lock.
+ *
+ * The placeholders of a buffer must not be passed to another buffer.
+ */
+template<typename Entity>
+class BasicCommandBuffers {
+    struct Slot {
+        std::atomic<std::thread::id> owner{};
+        BasicCommandBuffer<Entity> buffer;
+    };
+
+public:
+    /**
+     * @param max_threads The max number of threads which record concurrently.
+     */
+    explicit BasicCommandBuffers(std::size_t max_threads = std::thread::hardware_concurrency() + 1)
+        : slots_(new Slot[max_threads ? max_threads : 1]), slot_count_(max_threads ? max_threads : 1) {}
+
+    /**
+     * @brief Returns the command buffer of the calling thread.
+     */
+    BasicCommandBuffer<Entity> &local() {
+        const auto this_id = std::this_thread::get_id();
+
+        for (std::size_t i = 0; i < slot_count_; ++i) {
+            auto &slot = slots_[i];
+            auto owner = slot.owner.load(std::memory_order_acquire);
+            if (owner == this_id) return slot.buffer;
+
+            if (owner == std::thread::id{}
+                && slot.owner.compare_exchange_strong(owner, this_id, std::memory_order_acq_rel)) {
+                return slot.buffer;
+            }
+        }
+
+        throw std::runtime_error(ErrorFormatter<std::runtime_error>(__FILE__, __LINE__)
+                                 << "No command buffer left for the thread. max_threads: " << slot_count_);
+    }
+
+    /**
+     * @brief Applies the buffers in the order they were claimed, then releases them.
+     */
+    void playback(BasicRegistry<Entity> &registry) {
+        for (std::size_t i = 0; i < slot_count_; ++i) {
+            auto &slot = slots_[i];
+            if (slot.owner.load(std::memory_order_acquire) == std::thread::id{}) continue;
+
+            slot.buffer.playback(registry);
+            slot.owner.store(std::thread::id{}, std::memory_order_release);
+        }
+    }
+
+private:
+    std::unique_ptr<Slot[]> slots_;
+    std::size_t slot_count_;
+};
+
+using CommandBuffer = BasicCommandBuffer<Entity>;
+using CommandBuffers = BasicCommandBuffers<Entity>;
+
+} // namespace entities
+} // namespace nodec
+
+#endif
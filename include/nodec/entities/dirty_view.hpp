@@ -0,0 +1,88 @@
+#ifndef NODEC__ENTITIES__DIRTY_VIEW_HPP_
+#define NODEC__ENTITIES__DIRTY_VIEW_HPP_
+
+#include "../array_view.hpp"
+#include "../type_traits.hpp"
+#include "storage.hpp"
+
+#include <tuple>
+#include <vector>
+
+namespace nodec {
+namespace entities {
+
+template<typename, typename>
+class BasicDirtyView;
+
+/**
+ * @brief View over the dirty entities of a storage.
+ *
+ * It visits only the entities whose leading component was marked as changed
+ * (see BasicRegistry::patch() and BasicRegistry::mark_dirty()), so a system can
+ * do work proportional to the number of changes instead of all the entities.
+ *
+ * The dirty set of the leading storage is consumed by each(). The dirty entities
+ * which lack any of the other components are dropped as well.
+ */
+template<typename Entity, typename Leading, typename... Others>
+class BasicDirtyView<Entity, type_list<Leading, Others...>> {
+    bool others_contain([[maybe_unused]] const Entity entity) const {
+        return (std::get<Others *>(others_)->contains(entity) && ...);
+    }
+
+public:
+    // like-stl.
+    using entity_type = Entity;
+
+    BasicDirtyView(Leading &leading, Others &...others) noexcept
+        : leading_{&leading}, others_{&others...} {}
+
+    /**
+     * @brief Returns the dirty entities of the leading storage, not yet consumed.
+     */
+    ArrayView<const Entity> dirty() const noexcept {
+        return leading_->dirty();
+    }
+
+    std::size_t size_hint() const noexcept {
+        return leading_->dirty().size();
+    }
+
+    /**
+     * @brief Iterates the dirty entities and their components, then clears the dirty set.
+     *
+     * The entities marked by the function object are kept for the next call.
+     * The components removed by the function object are skipped.
+     *
+     * @param func void(Entity, Leading&, Others&...)
+     */
+    template<typename Func>
+    void each(Func func) {
+        leading_->take_dirty(processing_);
+
+        for (const auto entity : processing_) {
+            if (!leading_->contains(entity) || !others_contain(entity)) continue;
+
+            func(entity, leading_->get(entity), std::get<Others *>(others_)->get(entity)...);
+        }
+
+        processing_.clear();
+    }
+
+    /**
+     * @brief Discards the dirty entities without visiting them.
+     */
+    void clear() {
+        leading_->clear_dirty();
+    }
+
+private:
+    Leading *leading_;
+    std::tuple<Others *...> others_;
+    std::vector<Entity> processing_;
+};
+
+} // namespace entities
+} // namespace nodec
+
+#endif
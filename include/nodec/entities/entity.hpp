@@ -3,6 +3,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <type_traits>
 
 namespace nodec {
 namespace entities {
@@ -15,7 +16,7 @@ static constexpr int popcount(Type value) noexcept {
     return value ? (int(value & 1) + popcount(value >> 1)) : 0;
 }
 
-template<typename>
+template<typename, typename = void>
 struct entity_traits;
 
 /**
@@ -49,8 +50,64 @@ struct entity_traits<std::uint64_t> {
     static constexpr entity_type version_mask = 0xFFFFFFFF;
 };
 
+/**
+ * @brief Entity traits for an enum identifier, with the layout of its underlying type.
+ */
+template<typename Type>
+struct entity_traits<Type, std::enable_if_t<std::is_enum<Type>::value>>
+    : entity_traits<std::underlying_type_t<Type>> {
+    using value_type = Type;
+};
+
+template<std::size_t Bits>
+using version_for_bits_t = std::conditional_t<
+    (Bits <= 8), std::uint8_t,
+    std::conditional_t<(Bits <= 16), std::uint16_t,
+                       std::conditional_t<(Bits <= 32), std::uint32_t, std::uint64_t>>>;
+
+template<typename Type, typename = void>
+struct underlying_or_self {
+    using type = Type;
+};
+
+template<typename Type>
+struct underlying_or_self<Type, std::enable_if_t<std::is_enum<Type>::value>> {
+    using type = std::underlying_type_t<Type>;
+};
+
 } // namespace internal
 
+/**
+ * @brief Identifier layout with a custom split between the entity and the version parts.
+ *
+ * Use it to define the traits of a dedicated identifier type, usually an enum:
+ *
+ * @code{.cpp}
+ * enum class Particle : std::uint64_t {};
+ *
+ * template<>
+ * struct nodec::entities::entity_traits<Particle>
+ *     : nodec::entities::basic_entity_traits<nodec::entities::entity_layout<Particle, 40, 24>> {};
+ * @endcode
+ *
+ * @tparam Value The identifier type. An unsigned integral or an enum of such type.
+ * @tparam EntityBits The number of the bits of the entity part (number).
+ * @tparam VersionBits The number of the bits of the version part.
+ */
+template<typename Value, std::size_t EntityBits, std::size_t VersionBits>
+struct entity_layout {
+    using value_type = Value;
+    using entity_type = typename internal::underlying_or_self<Value>::type;
+    using version_type = internal::version_for_bits_t<VersionBits>;
+
+    static_assert(std::is_unsigned<entity_type>::value, "The identifier must be an unsigned integral.");
+    static_assert(EntityBits > 0 && VersionBits > 0, "Both parts need at least one bit.");
+    static_assert(EntityBits + VersionBits <= sizeof(entity_type) * 8, "The layout does not fit in the identifier.");
+
+    static constexpr entity_type entity_mask = static_cast<entity_type>((entity_type{1} << (EntityBits - 1)) * 2 - 1);
+    static constexpr entity_type version_mask = static_cast<entity_type>((entity_type{1} << (VersionBits - 1)) * 2 - 1);
+};
+
 /**
  * @brief Common basic entity traits implementation.
  *
@@ -111,7 +168,7 @@ public:
      * @return The integral representation of the version part.
      */
     static constexpr version_type to_version(const value_type value) noexcept {
-        return to_integral(value) >> entity_bit_length;
+        return static_cast<version_type>((to_integral(value) >> entity_bit_length) & version_mask);
     }
 
     /**
@@ -125,7 +182,7 @@ public:
      * @return A properly constructed identifier.
      */
     static constexpr value_type construct(const entity_type entity, const version_type version) noexcept {
-        return value_type{(entity & entity_mask) | (static_cast<entity_type>(version) << entity_bit_length)};
+        return value_type{(entity & entity_mask) | ((static_cast<entity_type>(version) & version_mask) << entity_bit_length)};
     }
 
     /**
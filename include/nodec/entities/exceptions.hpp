@@ -2,6 +2,9 @@
 #define NODEC__ENTITIES__EXCEPTIONS_HPP_
 
 #include "../formatter.hpp"
+#include "entity.hpp"
+
+#include <cstdint>
 
 namespace nodec {
 namespace entities {
@@ -9,17 +12,35 @@ namespace entities {
 template<typename Entity>
 inline void throw_invalid_entity_exception(const Entity entity, const char *file, size_t line) {
     throw std::runtime_error(ErrorFormatter<std::runtime_error>(file, line)
-                             << "Invalid entity detected. entity: 0x" << std::hex << entity
-                             << "(entity: 0x" << to_entity(entity) << "; version: 0x" << to_version(entity) << ")");
+                             << "Invalid entity detected. entity: 0x" << std::hex << to_integral(entity)
+                             << "(entity: 0x" << to_entity(entity) << "; version: 0x" << static_cast<std::uint64_t>(to_version(entity)) << ")");
 }
 
 template<typename Component, typename Entity>
 inline void throw_no_component_exception(const Entity entity, const char *file, size_t line) {
     throw std::runtime_error(ErrorFormatter<std::runtime_error>(file, line)
-                             << "Entity {0x" << std::hex << entity << "; entity: 0x" << to_entity(entity) << "; version: 0x" << to_version(entity)
+                             << "Entity {0x" << std::hex << to_integral(entity) << "; entity: 0x" << to_entity(entity) << "; version: 0x" << static_cast<std::uint64_t>(to_version(entity))
                              << "} doesn't have the component {" << typeid(Component).name() << "}.");
 }
 
+template<typename Component>
+inline void throw_pool_already_owned_exception(const char *file, size_t line) {
+    throw std::runtime_error(ErrorFormatter<std::runtime_error>(file, line)
+                             << "The storage of the component {" << typeid(Component).name() << "} is already owned by another group.");
+}
+
+template<typename Component>
+inline void throw_owned_pool_sort_exception(const char *file, size_t line) {
+    throw std::runtime_error(ErrorFormatter<std::runtime_error>(file, line)
+                             << "The storage of the component {" << typeid(Component).name() << "} is owned by a group and cannot be sorted.");
+}
+
+template<typename Component>
+inline void throw_component_not_copyable_exception(const char *file, size_t line) {
+    throw std::runtime_error(ErrorFormatter<std::runtime_error>(file, line)
+                             << "The component {" << typeid(Component).name() << "} is not copy constructible and cannot be cloned.");
+}
+
 } // namespace entities
 } // namespace nodec
 #endif
\ No newline at end of file
@@ -0,0 +1,179 @@
+#ifndef NODEC__ENTITIES__GROUP_HPP_
+#define NODEC__ENTITIES__GROUP_HPP_
+
+#include "../type_traits.hpp"
+#include "storage.hpp"
+
+#include <algorithm>
+#include <array>
+#include <tuple>
+
+namespace nodec {
+namespace entities {
+
+namespace internal {
+
+/**
+ * @brief Keeps the entities that have all the owned components in the first
+ * slots of every owned storage.
+ *
+ * Owned storages notify the handler on emplace/erase, and the handler swaps
+ * the element into or out of the group range [0, size()) of every owned storage,
+ * so all the owned storages share the same packed order in that range.
+ */
+template<typename Entity, typename... Owned>
+class GroupHandler final : public BaseStorageOwner<Entity> {
+    bool all_contain(const Entity entity) const {
+        std::array<bool, sizeof...(Owned)> values{std::get<Owned *>(pools_)->contains(entity)...};
+        return std::all_of(values.cbegin(), values.cend(), [](auto value) { return value; });
+    }
+
+    bool in_group(const Entity entity) const {
+        return all_contain(entity) && std::get<0>(pools_)->index(entity) < length_;
+    }
+
+    void swap_to(const Entity entity, const std::size_t pos) {
+        using Expander = int[];
+        (void)Expander{(std::get<Owned *>(pools_)->swap_elements(std::get<Owned *>(pools_)->index(entity), pos), 0)...};
+    }
+
+public:
+    GroupHandler(Owned &...pools)
+        : pools_{&pools...} {
+        using Expander = int[];
+        (void)Expander{(pools.bind_owner(this), 0)...};
+
+        // Collect the existing entities walking the smallest storage.
+        const auto *smallest = (std::min)({static_cast<const BaseStorage<Entity> *>(&pools)...},
+                                                 [](const auto *lhs, const auto *rhs) {
+                                                     return lhs->size() < rhs->size();
+                                                 });
+        for (std::size_t pos = 0; pos < smallest->size(); ++pos) {
+            on_emplaced(smallest->at(pos));
+        }
+    }
+
+    ~GroupHandler() {
+        using Expander = int[];
+        (void)Expander{(std::get<Owned *>(pools_)->bind_owner(nullptr), 0)...};
+    }
+
+    GroupHandler(const GroupHandler &) = delete;
+    GroupHandler &operator=(const GroupHandler &) = delete;
+
+    void on_emplaced(const Entity entity) override {
+        if (!all_contain(entity) || std::get<0>(pools_)->index(entity) < length_) return;
+
+        swap_to(entity, length_++);
+    }
+
+    void on_erasing(const Entity entity) override {
+        if (!in_group(entity)) return;
+
+        swap_to(entity, --length_);
+    }
+
+    std::size_t size() const noexcept {
+        return length_;
+    }
+
+    const std::tuple<Owned *...> &pools() const noexcept {
+        return pools_;
+    }
+
+private:
+    std::tuple<Owned *...> pools_;
+    std::size_t length_{0};
+};
+
+} // namespace internal
+
+template<typename, typename>
+class BasicGroup;
+
+/**
+ * @brief Owning group.
+ *
+ * A group owns the storages of its components. The entities that have all the
+ * owned components sit in the first size() slots of every owned storage in the
+ * same order, so the iteration is a linear walk over parallel arrays without
+ * any sparse lookup.
+ *
+ * The group handle is cheap to copy and is valid as long as the registry is alive.
+ */
+template<typename Entity, typename... Owned>
+class BasicGroup<Entity, type_list<Owned...>> {
+    using Handler = internal::GroupHandler<Entity, Owned...>;
+
+    template<typename Type>
+    static constexpr std::size_t index_of = type_list_index_v<std::remove_const_t<Type>, type_list<typename Owned::value_type...>>;
+
+public:
+    // like-stl.
+    using entity_type = Entity;
+    using iterator = typename BaseStorage<Entity>::const_iterator;
+
+    BasicGroup(Handler &handler) noexcept
+        : handler_{&handler} {}
+
+    /**
+     * @brief Returns the number of the entities in the group.
+     */
+    std::size_t size() const noexcept {
+        return handler_->size();
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    iterator begin() const noexcept {
+        const auto *pool = std::get<0>(handler_->pools());
+        return pool->begin() + static_cast<typename iterator::difference_type>(pool->size() - size());
+    }
+
+    iterator end() const noexcept {
+        return std::get<0>(handler_->pools())->end();
+    }
+
+    bool contains(const Entity entity) const {
+        const auto *pool = std::get<0>(handler_->pools());
+        return pool->contains(entity) && pool->index(entity) < size();
+    }
+
+    decltype(auto) get(const Entity entity) const {
+        return std::forward_as_tuple(std::get<Owned *>(handler_->pools())->get(entity)...);
+    }
+
+    template<typename Comp>
+    decltype(auto) get(const Entity entity) const {
+        return std::get<index_of<Comp>>(handler_->pools())->get(entity);
+    }
+
+    /**
+     * @brief Iterates the entities and their components.
+     *
+     * The elements are read by the packed position directly.
+     * Like the storage iterator, the walk goes from the back, so that the current
+     * entity can be removed from the group during the iteration.
+     *
+     * @param func void(Entity, Components&...)
+     */
+    template<typename Func>
+    void each(Func func) const {
+        const auto &pools = handler_->pools();
+        const auto *leading = std::get<0>(pools);
+
+        for (auto pos = size(); pos; --pos) {
+            func(leading->at(pos - 1), std::get<Owned *>(pools)->value_at(pos - 1)...);
+        }
+    }
+
+private:
+    Handler *handler_;
+};
+
+} // namespace entities
+} // namespace nodec
+
+#endif
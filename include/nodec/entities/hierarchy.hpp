@@ -0,0 +1,460 @@
+#ifndef NODEC__ENTITIES__HIERARCHY_HPP_
+#define NODEC__ENTITIES__HIERARCHY_HPP_
+
+#include "../array_view.hpp"
+#include "../containers/paged_sparse_array.hpp"
+#include "../formatter.hpp"
+#include "entity.hpp"
+#include "exceptions.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace nodec {
+namespace entities {
+
+template<typename Entity>
+inline void throw_hierarchy_cycle_exception(const Entity child, const Entity parent, const char *file, size_t line) {
+    throw std::invalid_argument(ErrorFormatter<std::invalid_argument>(file, line)
+                                << "The entity 0x" << std::hex << to_integral(parent)
+                                << " is the entity 0x" << to_integral(child) << " itself or its descendant, and cannot be its parent.");
+}
+
+template<typename Entity>
+inline void throw_hierarchy_stale_entity_exception(const Entity entity, const Entity current, const char *file, size_t line) {
+    throw std::invalid_argument(ErrorFormatter<std::invalid_argument>(file, line)
+                                << "The entity 0x" << std::hex << to_integral(entity)
+                                << " is older than the entity 0x" << to_integral(current)
+                                << " holding its number in the hierarchy.");
+}
+
+/**
+ * @brief Parent/child relationships of entities, kept in breadth-first order.
+ *
+ * Every node is placed after its parent in a packed order sorted by depth, so a
+ * propagation pass like `world = parent_world * local` is one forward sweep over
+ * the order, reading the parents from the already computed positions instead of
+ * chasing them through the sparse sets.
+ *
+ * The order is rebuilt lazily on the next access after the structure changed.
+ * The positions are stable until then, so the values computed by the sweep can
+ * live in dense arrays indexed by the position.
+ *
+ * The propagation is incremental. Only the nodes marked as changed and their
+ * descendants are visited. After the structure changed, every node is visited
+ * once, since the positions moved.
+ *
+ * @code{.cpp}
+ * std::vector<Matrix4x4f> world;
+ * hierarchy.mark_changed(entity);
+ * world.resize(hierarchy.size());
+ * hierarchy.propagate([&](Entity entity, std::size_t pos, std::size_t parent_pos) {
+ *     const auto local = trs(...);
+ *     world[pos] = parent_pos == Hierarchy::npos ? local : world[parent_pos] * local;
+ * });
+ * @endcode
+ *
+ * The hierarchy does not watch the registry. Remove the destroyed entities from it.
+ * If a recycled entity is added while its older version is still in, the older
+ * one is removed. Adding an entity older than the one holding its number throws.
+ */
+template<typename Entity>
+class BasicHierarchy {
+    using entity_traits_type = entity_traits<Entity>;
+
+    struct Node {
+        Entity entity;
+        Entity parent;
+        Entity first_child;
+        Entity last_child;
+        Entity prev_sibling;
+        Entity next_sibling;
+        std::size_t depth;
+    };
+
+    Node *try_node(const Entity entity) {
+        const auto *index = index_.try_get(entity_traits_type::to_entity(entity));
+        return index && nodes_[*index].entity == entity ? &nodes_[*index] : nullptr;
+    }
+
+    const Node *try_node(const Entity entity) const {
+        const auto *index = index_.try_get(entity_traits_type::to_entity(entity));
+        return index && nodes_[*index].entity == entity ? &nodes_[*index] : nullptr;
+    }
+
+    /**
+     * @brief Checks if the version of lhs comes after the one of rhs.
+     *
+     * The versions wrap around, so the one less than half the range ahead is the newer.
+     */
+    static bool is_newer(const Entity lhs, const Entity rhs) noexcept {
+        const auto distance = (static_cast<typename entity_traits_type::entity_type>(entity_traits_type::to_version(lhs))
+                               - static_cast<typename entity_traits_type::entity_type>(entity_traits_type::to_version(rhs)))
+                              & entity_traits_type::version_mask;
+        return distance != 0 && distance <= entity_traits_type::version_mask / 2;
+    }
+
+    Node &node_assured(const Entity entity) {
+        if (auto *node = try_node(entity)) return *node;
+
+        const auto number = entity_traits_type::to_entity(entity);
+        if (index_.contains(number)) {
+            const auto current = nodes_[index_[number]].entity;
+            if (!is_newer(entity, current)) {
+                throw_hierarchy_stale_entity_exception(entity, current, __FILE__, __LINE__);
+            }
+
+            // The number is held by an older version, which has been destroyed.
+            remove(current);
+        }
+
+        index_[number] = nodes_.size();
+        nodes_.push_back({entity, null_entity, null_entity, null_entity, null_entity, null_entity, 0u});
+        link(nodes_.back(), null_entity);
+        structure_changed_ = true;
+        return nodes_.back();
+    }
+
+    Node &node(const Entity entity) {
+        return nodes_[index_[entity_traits_type::to_entity(entity)]];
+    }
+
+    Entity &first_child_of(const Entity parent) {
+        return parent == null_entity ? first_root_ : node(parent).first_child;
+    }
+
+    Entity &last_child_of(const Entity parent) {
+        return parent == null_entity ? last_root_ : node(parent).last_child;
+    }
+
+    void link(Node &child, const Entity parent) {
+        child.parent = parent;
+        child.next_sibling = null_entity;
+        child.prev_sibling = last_child_of(parent);
+
+        if (child.prev_sibling == null_entity) {
+            first_child_of(parent) = child.entity;
+        } else {
+            node(child.prev_sibling).next_sibling = child.entity;
+        }
+        last_child_of(parent) = child.entity;
+    }
+
+    void unlink(Node &child) {
+        if (child.prev_sibling == null_entity) {
+            first_child_of(child.parent) = child.next_sibling;
+        } else {
+            node(child.prev_sibling).next_sibling = child.next_sibling;
+        }
+
+        if (child.next_sibling == null_entity) {
+            last_child_of(child.parent) = child.prev_sibling;
+        } else {
+            node(child.next_sibling).prev_sibling = child.prev_sibling;
+        }
+
+        child.parent = child.prev_sibling = child.next_sibling = null_entity;
+    }
+
+    /**
+     * @brief Rebuilds the breadth-first order, using the order itself as the queue.
+     */
+    void rebuild() {
+        order_.clear();
+        parent_positions_.clear();
+        order_.reserve(nodes_.size());
+        parent_positions_.reserve(nodes_.size());
+        positions_.resize(nodes_.size());
+
+        for (auto root = first_root_; root != null_entity; root = node(root).next_sibling) {
+            node(root).depth = 0u;
+            positions_[index_[entity_traits_type::to_entity(root)]] = order_.size();
+            order_.push_back(root);
+            parent_positions_.push_back(npos);
+        }
+
+        for (std::size_t pos = 0; pos < order_.size(); ++pos) {
+            const auto &parent = node(order_[pos]);
+            for (auto child = parent.first_child; child != null_entity;) {
+                auto &child_node = node(child);
+                child_node.depth = parent.depth + 1;
+                positions_[index_[entity_traits_type::to_entity(child)]] = order_.size();
+                order_.push_back(child);
+                parent_positions_.push_back(pos);
+                child = child_node.next_sibling;
+            }
+        }
+
+        changed_.assign(order_.size(), 1u);
+        first_changed_ = order_.empty() ? npos : 0u;
+        structure_changed_ = false;
+    }
+
+    void refresh() {
+        if (structure_changed_) rebuild();
+    }
+
+public:
+    // like-stl.
+    using entity_type = Entity;
+
+    //! The parent position of the roots.
+    static constexpr std::size_t npos = (std::numeric_limits<std::size_t>::max)();
+
+    /**
+     * @brief Makes the parent the parent of the child.
+     *
+     * The entities not in the hierarchy yet are added as roots first. The child
+     * is attached as the last child of the parent. If the parent is null_entity,
+     * the child becomes a root.
+     *
+     * @throws std::invalid_argument If the parent is the child or its descendant,
+     *   or if an entity is older than the one holding its number.
+     */
+    void set_parent(const Entity child, const Entity parent) {
+        if (parent != null_entity) {
+            for (auto ancestor = parent; ancestor != null_entity;) {
+                if (ancestor == child) throw_hierarchy_cycle_exception(child, parent, __FILE__, __LINE__);
+                const auto *ancestor_node = try_node(ancestor);
+                ancestor = ancestor_node ? ancestor_node->parent : null_entity;
+            }
+            node_assured(parent);
+        }
+
+        // The parent may have moved the nodes, so take the child after it.
+        auto &child_node = node_assured(child);
+        if (child_node.parent == parent) return;
+
+        unlink(child_node);
+        link(child_node, parent);
+        structure_changed_ = true;
+    }
+
+    /**
+     * @brief Adds the entity as a root, if it is not in the hierarchy.
+     *
+     * @throws std::invalid_argument If the entity is older than the one holding its number.
+     */
+    void emplace(const Entity entity) {
+        node_assured(entity);
+    }
+
+    /**
+     * @brief Removes the entity. Its children become roots.
+     *
+     * @return true if the entity was in the hierarchy.
+     */
+    bool remove(const Entity entity) {
+        auto *target = try_node(entity);
+        if (!target) return false;
+
+        while (target->first_child != null_entity) {
+            auto &child = node(target->first_child);
+            unlink(child);
+            link(child, null_entity);
+        }
+        unlink(*target);
+
+        // Swap with the last node.
+        const auto number = entity_traits_type::to_entity(entity);
+        const auto index = index_[number];
+        if (index != nodes_.size() - 1) {
+            nodes_[index] = nodes_.back();
+            index_[entity_traits_type::to_entity(nodes_[index].entity)] = index;
+        }
+        nodes_.pop_back();
+        index_.erase(number);
+
+        structure_changed_ = true;
+        return true;
+    }
+
+    /**
+     * @brief Removes the entity and all its descendants.
+     *
+     * @return The number of the removed entities.
+     */
+    std::size_t remove_subtree(const Entity entity) {
+        if (!contains(entity)) return 0u;
+
+        std::vector<Entity> subtree{entity};
+        for (std::size_t i = 0; i < subtree.size(); ++i) {
+            for (auto child = node(subtree[i]).first_child; child != null_entity; child = node(child).next_sibling) {
+                subtree.push_back(child);
+            }
+        }
+
+        // Remove the leaves first, so no child is relinked to the roots.
+        for (auto it = subtree.rbegin(); it != subtree.rend(); ++it) {
+            remove(*it);
+        }
+        return subtree.size();
+    }
+
+    bool contains(const Entity entity) const {
+        return try_node(entity) != nullptr;
+    }
+
+    /**
+     * @brief Returns the parent, or null_entity for the roots and the entities not in the hierarchy.
+     */
+    Entity parent(const Entity entity) const {
+        const auto *target = try_node(entity);
+        return target ? target->parent : null_entity;
+    }
+
+    /**
+     * @brief Iterates the children in the attached order.
+     *
+     * @param func void(Entity)
+     */
+    template<typename Func>
+    void each_child(const Entity entity, Func func) const {
+        const auto *target = try_node(entity);
+        if (!target) return;
+
+        for (auto child = target->first_child; child != null_entity;) {
+            const auto next = try_node(child)->next_sibling;
+            func(child);
+            child = next;
+        }
+    }
+
+    /**
+     * @brief Returns the depth of the entity. The roots are at depth zero.
+     */
+    std::size_t depth(const Entity entity) {
+        refresh();
+        const auto *target = try_node(entity);
+        return target ? target->depth : 0u;
+    }
+
+    std::size_t size() const noexcept {
+        return nodes_.size();
+    }
+
+    bool empty() const noexcept {
+        return nodes_.empty();
+    }
+
+    /**
+     * @brief Returns the entities in breadth-first order.
+     *
+     * Every entity comes after its parent.
+     */
+    ArrayView<const Entity> order() {
+        refresh();
+        return {order_.data(), order_.size()};
+    }
+
+    /**
+     * @brief Returns the positions of the parents in the order, or npos for the roots.
+     */
+    ArrayView<const std::size_t> parent_positions() {
+        refresh();
+        return {parent_positions_.data(), parent_positions_.size()};
+    }
+
+    /**
+     * @brief Returns the position of the entity in the order, or npos if it is not in the hierarchy.
+     */
+    std::size_t position(const Entity entity) {
+        refresh();
+        const auto *index = index_.try_get(entity_traits_type::to_entity(entity));
+        return index && nodes_[*index].entity == entity ? positions_[*index] : npos;
+    }
+
+    /**
+     * @brief Marks the local value of the entity as changed.
+     *
+     * The next propagate() visits the entity and its descendants.
+     */
+    void mark_changed(const Entity entity) {
+        const auto pos = position(entity);
+        if (pos == npos) return;
+
+        changed_[pos] = 1u;
+        if (first_changed_ == npos || pos < first_changed_) first_changed_ = pos;
+    }
+
+    /**
+     * @brief Checks if any entity waits for the propagation.
+     */
+    bool has_changes() const noexcept {
+        return structure_changed_ || first_changed_ != npos;
+    }
+
+    /**
+     * @brief Visits the changed entities and their descendants, parents first.
+     *
+     * The sweep starts from the first changed position, since the entities
+     * before it cannot descend from a changed one.
+     *
+     * @param func void(Entity entity, std::size_t pos, std::size_t parent_pos)
+     *   parent_pos is npos for the roots.
+     * @return The number of the visited entities.
+     */
+    template<typename Func>
+    std::size_t propagate(Func func) {
+        refresh();
+        if (first_changed_ == npos) return 0u;
+
+        std::size_t visited = 0u;
+        for (std::size_t pos = first_changed_; pos < order_.size(); ++pos) {
+            const auto parent_pos = parent_positions_[pos];
+            if (!changed_[pos]) {
+                if (parent_pos == npos || !changed_[parent_pos]) continue;
+                changed_[pos] = 1u;
+            }
+
+            func(order_[pos], pos, parent_pos);
+            ++visited;
+        }
+
+        std::fill(changed_.begin() + static_cast<std::ptrdiff_t>(first_changed_), changed_.end(), 0u);
+        first_changed_ = npos;
+        return visited;
+    }
+
+    void clear() {
+        for (const auto &target : nodes_) {
+            index_.erase(entity_traits_type::to_entity(target.entity));
+        }
+        nodes_.clear();
+        order_.clear();
+        parent_positions_.clear();
+        positions_.clear();
+        changed_.clear();
+        first_root_ = last_root_ = null_entity;
+        first_changed_ = npos;
+        structure_changed_ = false;
+    }
+
+private:
+    std::vector<Node> nodes_;
+    containers::PagedSparseArray<std::size_t> index_;
+
+    Entity first_root_{null_entity};
+    Entity last_root_{null_entity};
+
+    // The breadth-first order and its parallel arrays.
+    std::vector<Entity> order_;
+    std::vector<std::size_t> parent_positions_;
+    std::vector<unsigned char> changed_;
+
+    //! The positions by the node index.
+    std::vector<std::size_t> positions_;
+
+    std::size_t first_changed_{npos};
+    bool structure_changed_{false};
+};
+
+using Hierarchy = BasicHierarchy<Entity>;
+
+} // namespace entities
+} // namespace nodec
+
+#endif
@@ -1,16 +1,22 @@
 #ifndef NODEC__ENTITIES__REGISTRY_HPP_
 #define NODEC__ENTITIES__REGISTRY_HPP_
 
+#include "../containers/paged_vector.hpp"
 #include "../formatter.hpp"
 #include "../type_info.hpp"
 #include "../utility.hpp"
+#include "dirty_view.hpp"
 #include "entity.hpp"
 #include "exceptions.hpp"
+#include "group.hpp"
+#include "runtime_view.hpp"
+#include "signature.hpp"
 #include "storage.hpp"
 #include "view.hpp"
 
 #include <algorithm>
 #include <cassert>
+#include <iterator>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
@@ -19,24 +25,64 @@
 namespace nodec {
 namespace entities {
 
+template<typename Entity>
+class BasicSnapshot;
+
+template<typename Entity>
+class BasicSnapshotLoader;
+
+/**
+ * @brief Memory statistics of a registry.
+ */
+struct RegistryStats {
+    //! The number of the entities still in use.
+    std::size_t entities{0};
+
+    //! The number of the identifiers, including the released ones.
+    std::size_t entity_capacity{0};
+
+    std::size_t entity_bytes{0};
+    std::size_t signature_bytes{0};
+    std::size_t pool_count{0};
+
+    //! The sum of the statistics of all the storages.
+    StorageStats storages{};
+
+    std::size_t total_bytes() const noexcept {
+        return entity_bytes + signature_bytes + storages.total_bytes();
+    }
+};
+
 template<typename Entity>
 class BasicRegistry {
     template<typename Type>
     using Storage = storage_for_t<Entity, Type>;
 
+    static constexpr std::size_t ENTITY_PAGE_SIZE = 4096;
+
+    friend class BasicSnapshot<Entity>;
+    friend class BasicSnapshotLoader<Entity>;
+
     struct PoolData {
         std::unique_ptr<BaseStorage<Entity>> pool;
 
         const type_info *component_type;
     };
 
+    struct GroupData {
+        std::unique_ptr<BaseStorageOwner<Entity>> handler;
+
+        const type_info *handler_type;
+    };
+
 public:
     using entity_traits_type = entity_traits<Entity>;
     using entity_type = Entity;
 
 private:
     decltype(auto) generate_identifier(const std::size_t pos) noexcept {
-        assert(pos < entity_traits_type::to_integral(null_entity) && "No entities available");
+        // The last number is reserved for the null entity.
+        assert(pos < entity_traits_type::entity_mask && "No entities available");
         return entity_traits_type::combine(static_cast<typename entity_traits_type::entity_type>(pos), {});
     }
 
@@ -67,6 +113,8 @@ private:
         if (!pool_data.pool) {
             pool_data.pool.reset(new Storage<Component>());
             pool_data.pool->bind_registry(const_cast<BasicRegistry *>(this));
+            pool_data.pool->bind_signatures(&signatures, index);
+            pool_data.pool->set_events_deferred(component_events_deferred_);
             pool_data.component_type = &type_id<Component>();
         }
 
@@ -100,6 +148,26 @@ private:
         return const_cast<Storage<Component> *>(as_const(*this).template pool_if_exists<Component>());
     }
 
+    void rebind_pools() noexcept {
+        for (std::size_t index = 0; index < pools.size(); ++index) {
+            auto *pool = pools[index].pool.get();
+            if (!pool) continue;
+            pool->bind_registry(this);
+
+            // The bits are already reserved, so it does not allocate.
+            pool->bind_signatures(&signatures, index);
+        }
+    }
+
+    template<typename It>
+    void validate_entities(It first, It last) const {
+        for (; first != last; ++first) {
+            if (!is_valid(*first)) {
+                throw_invalid_entity_exception(*first, __FILE__, __LINE__);
+            }
+        }
+    }
+
 public:
     /**
      * @brief Default constructor.
@@ -107,15 +175,41 @@ public:
     BasicRegistry() = default;
 
     /**
-     * @brief Default move constructor.
+     * @brief Move constructor.
+     *
+     * The storages are taken over and bound to this registry, as they refer to
+     * the registry and its signatures.
      */
-    BasicRegistry(BasicRegistry &&) = default;
+    BasicRegistry(BasicRegistry &&other) noexcept
+        : pools{std::move(other.pools)},
+          signatures{std::move(other.signatures)},
+          groups{std::move(other.groups)},
+          entities{std::move(other.entities)},
+          free_list{other.free_list},
+          component_events_deferred_{other.component_events_deferred_} {
+        other.free_list = tombstone_entity;
+        rebind_pools();
+    }
 
     /**
-     * @brief Default move assignment operator.
+     * @brief Move assignment operator.
      * @return This registry.
      */
-    BasicRegistry &operator=(BasicRegistry &&) = default;
+    BasicRegistry &operator=(BasicRegistry &&other) noexcept {
+        if (this == &other) return *this;
+
+        // Groups are destroyed before the pools they own.
+        groups = std::move(other.groups);
+        pools = std::move(other.pools);
+        signatures = std::move(other.signatures);
+        entities = std::move(other.entities);
+        free_list = other.free_list;
+        component_events_deferred_ = other.component_events_deferred_;
+
+        other.free_list = tombstone_entity;
+        rebind_pools();
+        return *this;
+    }
 
     /**
      * @brief Checks if an identifier refers to a valid entity.
@@ -141,6 +235,25 @@ public:
         return (free_list == null_entity) ? (entities.emplace_back(generate_identifier(entities.size())), entities.back()) : recycle_identifier();
     }
 
+    /**
+     * @brief Creates new entities and assigns them to a range.
+     *
+     * Recycled identifiers are used first, then the entity list is grown once
+     * for the remaining ones.
+     */
+    template<typename It>
+    void create_entities(It first, It last) {
+        for (; free_list != null_entity && first != last; ++first) {
+            *first = recycle_identifier();
+        }
+
+        entities.reserve(entities.size() + static_cast<std::size_t>(std::distance(first, last)));
+        for (; first != last; ++first) {
+            entities.emplace_back(generate_identifier(entities.size()));
+            *first = entities.back();
+        }
+    }
+
     /**
      * @brief Destroys an entity.
      *   When an entity is destroyed, its version is updated and the identifier
@@ -206,11 +319,10 @@ public:
      */
     template<typename... Components>
     bool all_of(const Entity entity) const {
-        // NOTE: If over C++17, we can use fold expression.
-        //  return (pool_assured<std::remove_const_t<Type>>().contains(entt) && ...);
+        if (!is_valid(entity)) return false;
 
-        std::array<bool, sizeof...(Components)> values{pool_assured<std::remove_const_t<Components>>()->contains(entity)...};
-        return std::all_of(values.cbegin(), values.cend(), [](auto value) { return value; });
+        [[maybe_unused]] const auto number = entity_traits_type::to_entity(entity);
+        return (signatures.test(number, type_id<std::remove_const_t<Components>>().seq_index()) && ...);
     }
 
     /**
@@ -218,11 +330,10 @@ public:
      */
     template<typename... Components>
     bool any_of(const Entity entity) const {
-        // NOTE: If over C++17, we can use fold expression.
-        //  return (pool_assured<std::remove_const_t<Type>>().contains(entt) || ...);
+        if (!is_valid(entity)) return false;
 
-        std::array<bool, sizeof...(Components)> values{pool_assured<std::remove_const_t<Components>>()->contains(entity)...};
-        return std::any_of(values.cbegin(), values.cend(), [](auto value) { return value; });
+        [[maybe_unused]] const auto number = entity_traits_type::to_entity(entity);
+        return (signatures.test(number, type_id<std::remove_const_t<Components>>().seq_index()) || ...);
     }
 
     void clear() {
@@ -238,6 +349,42 @@ public:
             });
     }
 
+    /**
+     * @brief Creates entities with copies of all the components of a prototype.
+     *
+     * Each pool of the prototype appends the copies for all the new entities in
+     * one pass, and delivers their construction events as one batch through
+     * components_constructed(). component_constructed() is still emitted for
+     * each entity, before the batch, unless the events are deferred.
+     *
+     * @param prototype The entity to copy the components from.
+     * @param count The number of the entities to create.
+     * @param out The output iterator to which the new entities are written.
+     * @return The output iterator past the last written entity.
+     * @throw std::runtime_error If the prototype is invalid, or one of its components is not copy constructible.
+     */
+    template<typename OutIt>
+    OutIt instantiate(const Entity prototype, const std::size_t count, OutIt out) {
+        if (!is_valid(prototype)) {
+            throw_invalid_entity_exception(prototype, __FILE__, __LINE__);
+        }
+
+        std::vector<Entity> clones(count);
+        create_entities(clones.begin(), clones.end());
+
+        // Take the pools first, since the listeners may change the prototype.
+        std::vector<std::size_t> indices;
+        signatures.each_reverse(entity_traits_type::to_entity(prototype), [&](const std::size_t index) {
+            indices.push_back(index);
+        });
+
+        for (auto iter = indices.rbegin(); iter != indices.rend(); ++iter) {
+            pools[*iter].pool->clone(prototype, clones.data(), clones.data() + clones.size());
+        }
+
+        return std::copy(clones.begin(), clones.end(), out);
+    }
+
     template<typename Component, typename... Args>
     decltype(auto) emplace_component(const Entity entity, Args &&...args) {
         if (!is_valid(entity)) {
@@ -247,6 +394,38 @@ public:
         return pool_assured<Component>()->emplace(entity, std::forward<Args>(args)...);
     }
 
+    /**
+     * @brief Assigns the given component to all the entities in a range.
+     *
+     * The component storage is reserved once, and the construction events are
+     * emitted in one batch through components_constructed(), after all the
+     * components are constructed. Unless the events are deferred,
+     * component_constructed() is also emitted for each entity before the batch.
+     * The entities that already have the component are left untouched.
+     *
+     * @param value The value to copy to each entity.
+     * @return The number of the components actually constructed.
+     */
+    template<typename Component, typename It>
+    std::size_t insert_components(It first, It last, const Component &value = {}) {
+        validate_entities(first, last);
+        return pool_assured<Component>()->insert(first, last, value);
+    }
+
+    /**
+     * @brief Assigns the given component to all the entities in a range, copying
+     * the values from another range.
+     *
+     * @param from The beginning of the value range, one value per entity.
+     * @return The number of the components actually constructed.
+     */
+    template<typename Component, typename It, typename CIt,
+             typename = std::enable_if_t<std::is_same<std::decay_t<typename std::iterator_traits<CIt>::value_type>, Component>::value>>
+    std::size_t insert_components(It first, It last, CIt from) {
+        validate_entities(first, last);
+        return pool_assured<Component>()->insert(first, last, from);
+    }
+
     template<typename Component>
     bool remove_component(const Entity entity) {
         auto *pool = pool_if_exists<Component>();
@@ -262,12 +441,20 @@ public:
         })(pool_if_exists<Components>())...);
     }
 
+    /**
+     * @brief Removes all the components of an entity.
+     *
+     * Only the pools in the component signature of the entity are touched.
+     * The components added by the destroy signal listeners are removed as well.
+     */
     void remove_all_components(const Entity entity) {
-        for (auto pos = pools.size(); pos; --pos) {
-            auto &pool_date = pools[pos - 1];
-            if (pool_date.pool) {
-                pool_date.pool->erase(entity);
-            }
+        if (!is_valid(entity)) return;
+
+        const auto number = entity_traits_type::to_entity(entity);
+        while (!signatures.none(number)) {
+            signatures.each_reverse(number, [&](const std::size_t index) {
+                pools[index].pool->erase(entity);
+            });
         }
     }
 
@@ -355,6 +542,47 @@ public:
         return std::make_tuple(try_get_component<Components>(entity)...);
     }
 
+    /**
+     * @brief Applies the given function to the component of the entity, and marks it as changed.
+     *
+     * @param func void(Component&)
+     * @return The reference to the patched component.
+     */
+    template<typename Component, typename Func>
+    Component &patch(const Entity entity, Func func) {
+        auto &component = get_component<Component>(entity);
+        func(component);
+        pool_if_exists<Component>()->mark_dirty(entity);
+        return component;
+    }
+
+    /**
+     * @brief Marks the component of the entity as changed.
+     *
+     * @return false if the entity doesn't have the component.
+     */
+    template<typename Component>
+    bool mark_dirty(const Entity entity) {
+        auto *pool = pool_if_exists<Component>();
+        return pool != nullptr && pool->mark_dirty(entity);
+    }
+
+    template<typename Component>
+    bool is_dirty(const Entity entity) const {
+        const auto *pool = pool_if_exists<Component>();
+        return pool != nullptr && pool->is_dirty(entity);
+    }
+
+    /**
+     * @brief Returns a view over the entities whose Type component was marked as changed.
+     *
+     * @see BasicDirtyView
+     */
+    template<typename Type, typename... Others>
+    BasicDirtyView<Entity, type_list<Storage<Type>, Storage<Others>...>> dirty_view() {
+        return {*pool_assured<Type>(), *pool_assured<Others>()...};
+    }
+
     /**
      * @brief Returns a view for the given components.
      *
@@ -382,6 +610,69 @@ public:
             *pool_assured<std::remove_const_t<Exclusions>>()...};
     }
 
+    /**
+     * @brief Returns a view for the components given at runtime.
+     *
+     * The pools are looked up once here. No pool is created, so the view is
+     * empty if one of the included components has never been emplaced.
+     *
+     * @param includes Types of components used to construct the view.
+     * @param excludes Types of components used to filter the view.
+     */
+    BasicRuntimeView<Entity> runtime_view(ArrayView<const type_info> includes,
+                                          ArrayView<const type_info> excludes = {}) {
+        const auto pool_of = [&](const type_info &type) -> BaseStorage<Entity> * {
+            const auto index = type.seq_index();
+            return index < pools.size() ? pools[index].pool.get() : nullptr;
+        };
+
+        std::vector<BaseStorage<Entity> *> included;
+        included.reserve(includes.size());
+        std::transform(includes.begin(), includes.end(), std::back_inserter(included), pool_of);
+
+        std::vector<const BaseStorage<Entity> *> excluded;
+        excluded.reserve(excludes.size());
+        std::transform(excludes.begin(), excludes.end(), std::back_inserter(excluded), pool_of);
+
+        return {std::move(included), std::move(excluded)};
+    }
+
+    /**
+     * @brief Returns an owning group for the given components.
+     *
+     * The first call creates the group, which takes the ownership of the storages
+     * and arranges the existing entities. Later calls return the same group.
+     * A storage can be owned by only one group.
+     *
+     * @tparam Owned Types of components owned by the group.
+     * @return The group handle.
+     * @throw std::runtime_error If one of the storages is already owned by another group.
+     */
+    template<typename... Owned>
+    BasicGroup<Entity, type_list<Storage<Owned>...>> group() {
+        static_assert(sizeof...(Owned) > 0, "Must provide one or more component types");
+
+        using Handler = internal::GroupHandler<Entity, Storage<Owned>...>;
+
+        for (auto &group_data : groups) {
+            if (*group_data.handler_type == type_id<Handler>()) {
+                return {static_cast<Handler &>(*group_data.handler)};
+            }
+        }
+
+        using Expander = int[];
+        (void)Expander{([this]() {
+            if (pool_assured<Owned>()->owner() != nullptr) {
+                throw_pool_already_owned_exception<Owned>(__FILE__, __LINE__);
+            }
+        }(), 0)...};
+
+        std::unique_ptr<Handler> handler{new Handler(*pool_assured<Owned>()...)};
+        auto &handler_ref = *handler;
+        groups.push_back({std::move(handler), &type_id<Handler>()});
+        return {handler_ref};
+    }
+
     /**
      * @brief Visits an entity and returns the type seq index and opaque pointer for its components.
      *
@@ -393,15 +684,47 @@ public:
      */
     template<typename Func>
     void visit(Entity entity, Func func) const {
-        for (auto pos = pools.size(); pos; --pos) {
-            const auto &pool_data = pools[pos - 1];
-            if (!pool_data.pool) continue;
+        if (!is_valid(entity)) return;
+
+        signatures.each_reverse(entity_traits_type::to_entity(entity), [&](const std::size_t index) {
+            const auto &pool_data = pools[index];
 
             auto component = pool_data.pool->try_get_opaque(entity);
-            if (!component) continue;
+            if (!component) return;
 
             func(*pool_data.component_type, component);
-        }
+        });
+    }
+
+    /**
+     * @brief Sorts the pool of the given component by the entities.
+     *
+     * @see BasicStorage::sort()
+     */
+    template<typename Component, typename Compare, typename Sort = StdSort>
+    void sort(Compare compare, Sort algorithm = Sort{}) {
+        pool_assured<Component>()->sort(std::move(compare), std::move(algorithm));
+    }
+
+    /**
+     * @brief Sorts the pool of the given component by the component values.
+     *
+     * @see BasicStorage::sort_by_value()
+     */
+    template<typename Component, typename Compare, typename Sort = StdSort>
+    void sort_by_value(Compare compare, Sort algorithm = Sort{}) {
+        pool_assured<Component>()->sort_by_value(std::move(compare), std::move(algorithm));
+    }
+
+    /**
+     * @brief Sorts the pool of To to follow the order of the pool of From.
+     *
+     * After this, the views iterating both the components driven by From touch the
+     * components of To sequentially.
+     */
+    template<typename To, typename From>
+    void sort_as() {
+        pool_assured<To>()->sort_as(*pool_assured<From>());
     }
 
     /**
@@ -420,10 +743,136 @@ public:
         return pool_assured<Component>()->element_destroyed();
     }
 
+    /**
+     * @brief Returns signal interface emitted with the constructed entities in batches.
+     *
+     * It is emitted on flush_component_events() in the deferred event mode, and
+     * by insert_components(), instantiate() and the snapshot loading in either mode. Outside of the
+     * deferred event mode, component_constructed() is also emitted for each of
+     * these entities, so listen to one of the two.
+     */
+    template<typename Component>
+    decltype(auto) components_constructed() {
+        return pool_assured<Component>()->elements_constructed();
+    }
+
+    /**
+     * @brief Returns signal interface emitted with the destroyed entities in batches
+     * on flush_component_events().
+     */
+    template<typename Component>
+    decltype(auto) components_destroyed() {
+        return pool_assured<Component>()->elements_destroyed();
+    }
+
+    /**
+     * @brief Switches the deferred component event mode of all the pools.
+     *
+     * While deferred, component_constructed() and component_destroyed() are not emitted.
+     * The entities are buffered per pool instead, and flush_component_events() emits
+     * them through components_constructed() and components_destroyed().
+     *
+     * Turning the mode off does not flush the buffered events.
+     */
+    void set_component_events_deferred(bool deferred) {
+        component_events_deferred_ = deferred;
+        for (auto &pool_data : pools) {
+            if (pool_data.pool) pool_data.pool->set_events_deferred(deferred);
+        }
+    }
+
+    bool component_events_deferred() const noexcept {
+        return component_events_deferred_;
+    }
+
+    /**
+     * @brief Emits the buffered component events of all the pools.
+     *
+     * Each pool emits its destroyed entities, then its constructed entities.
+     * A component constructed and destroyed before the flush is in neither
+     * batch. See BasicStorage::flush_events().
+     *
+     * The listeners may add or remove components, even of the other types.
+     * Such events are emitted in this flush as well.
+     */
+    void flush_component_events() {
+        // The listeners may add pools, so iterate by index.
+        bool flushed = true;
+        while (flushed) {
+            flushed = false;
+            for (std::size_t i = 0; i < pools.size(); ++i) {
+                auto *pool = pools[i].pool.get();
+                if (!pool || !pool->has_pending_events()) continue;
+                pool->flush_events();
+                flushed = true;
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the memory statistics of the storage of the given component.
+     */
+    template<typename Component>
+    StorageStats storage_stats() const {
+        const auto *pool = pool_if_exists<Component>();
+        return pool ? pool->stats() : StorageStats{};
+    }
+
+    /**
+     * @brief Calls the function with the memory statistics of each storage.
+     *
+     * @param func void(const type_info &, const StorageStats &)
+     */
+    template<typename Func>
+    void each_storage_stats(Func func) const {
+        for (const auto &pool_data : pools) {
+            if (!pool_data.pool) continue;
+            func(*pool_data.component_type, pool_data.pool->stats());
+        }
+    }
+
+    /**
+     * @brief Returns the registry-wide memory statistics.
+     */
+    RegistryStats memory_stats() const {
+        RegistryStats stats;
+        each_entity([&](auto) { ++stats.entities; });
+        stats.entity_capacity = entities.size();
+        stats.entity_bytes = entities.capacity() * sizeof(Entity);
+        stats.signature_bytes = signatures.memory_usage();
+        each_storage_stats([&](const auto &, const auto &pool_stats) {
+            ++stats.pool_count;
+            stats.storages += pool_stats;
+        });
+        return stats;
+    }
+
+    /**
+     * @brief Gives the slack memory back, for example after a mass destruction.
+     *
+     * The storages release the unused capacity and the empty sparse pages or groups.
+     * The identifiers are kept, since the released ones carry their next versions.
+     */
+    void compact() {
+        for (auto &pool_data : pools) {
+            if (pool_data.pool) pool_data.pool->shrink_to_fit();
+        }
+        signatures.shrink_to_fit();
+    }
+
 private:
     std::vector<PoolData> pools{};
-    std::vector<Entity> entities;
+
+    //! Which pools contain each entity. The bit index is the pool index.
+    ComponentSignatures signatures{};
+
+    //! Groups are destroyed before the pools they own.
+    std::vector<GroupData> groups{};
+
+    //! Paged, so that growing a large world never relocates the identifiers.
+    containers::BasicPagedVector<Entity, ENTITY_PAGE_SIZE> entities;
     Entity free_list{tombstone_entity};
+    bool component_events_deferred_{false};
 };
 
 using Registry = BasicRegistry<Entity>;
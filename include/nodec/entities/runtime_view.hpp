@@ -0,0 +1,154 @@
+#ifndef NODEC__ENTITIES__RUNTIME_VIEW_HPP_
+#define NODEC__ENTITIES__RUNTIME_VIEW_HPP_
+
+#include "../array_view.hpp"
+#include "storage.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace nodec {
+namespace entities {
+
+/**
+ * @brief View whose components are given at runtime.
+ *
+ * It is built by BasicRegistry::runtime_view() from lists of type_info, for the
+ * callers which do not know the component types at compile time like editors
+ * and scripting layers.
+ *
+ * The pools are resolved once at the construction. The iteration walks the
+ * smallest included pool, and hands the opaque pointers of the components in
+ * the order of the included types.
+ *
+ * If one of the included components has no pool yet, the view is empty.
+ */
+template<typename Entity>
+class BasicRuntimeView {
+    using BaseStorage = entities::BaseStorage<Entity>;
+
+    bool others_contain(const Entity entity) const {
+        return std::all_of(pools_.cbegin(), pools_.cend(), [&](const auto *pool) {
+            return pool == leading_ || pool->contains(entity);
+        });
+    }
+
+    bool excluded(const Entity entity) const {
+        return std::any_of(filter_.cbegin(), filter_.cend(), [&](const auto *pool) { return pool->contains(entity); });
+    }
+
+public:
+    // like-stl.
+    using entity_type = Entity;
+
+    BasicRuntimeView() noexcept
+        : leading_{nullptr} {}
+
+    /**
+     * @param pools The included pools. The null pools make the view empty.
+     * @param filter The excluded pools. The null pools are ignored.
+     */
+    BasicRuntimeView(std::vector<BaseStorage *> pools, std::vector<const BaseStorage *> filter)
+        : pools_(std::move(pools)), filter_(std::move(filter)), leading_{nullptr} {
+        filter_.erase(std::remove(filter_.begin(), filter_.end(), nullptr), filter_.end());
+
+        if (pools_.empty() || std::find(pools_.begin(), pools_.end(), nullptr) != pools_.end()) return;
+
+        leading_ = *std::min_element(pools_.begin(), pools_.end(), [](const auto *lhs, const auto *rhs) {
+            return lhs->size() < rhs->size();
+        });
+    }
+
+    /**
+     * @brief Returns the upper bound of the number of the entities in the view.
+     */
+    std::size_t size_hint() const noexcept {
+        return leading_ ? leading_->size() : 0u;
+    }
+
+    bool contains(const Entity entity) const {
+        return leading_ && leading_->contains(entity) && others_contain(entity) && !excluded(entity);
+    }
+
+    /**
+     * @brief Iterates the entities and the opaque pointers to their components.
+     *
+     * The structure of the registry must not be changed during the iteration.
+     *
+     * The components of the contiguous pools are addressed directly. The ones of
+     * the paged pools (component_traits::page_size) take a virtual call per entity.
+     *
+     * @param func void(Entity, ArrayView<void *> components)
+     */
+    template<typename Func>
+    void each(Func func) const {
+        if (!leading_) return;
+
+        // Resolve the contiguous values once, so most of the lookups need no virtual call.
+        struct Column {
+            BaseStorage *pool;
+            unsigned char *data;
+            std::size_t stride;
+        };
+
+        std::vector<Column> columns;
+        columns.reserve(pools_.size());
+        for (auto *pool : pools_) {
+            columns.push_back({pool, static_cast<unsigned char *>(pool->opaque_data()), pool->value_size()});
+        }
+
+        std::vector<void *> components(pools_.size());
+        for (auto first = leading_->begin(), last = leading_->end(); first != last; ++first) {
+            const auto entity = *first;
+
+            bool contained = true;
+            for (std::size_t i = 0; i < columns.size() && contained; ++i) {
+                const auto &column = columns[i];
+
+                std::size_t pos = static_cast<std::size_t>(first.index());
+                if (column.pool != leading_) {
+                    const auto *index = column.pool->try_index(entity);
+                    if (!index) {
+                        contained = false;
+                        break;
+                    }
+                    pos = *index;
+                }
+                components[i] = column.data ? column.data + pos * column.stride : column.pool->opaque_at(pos);
+            }
+            if (!contained || excluded(entity)) continue;
+
+            func(entity, ArrayView<void *>(components));
+        }
+    }
+
+    /**
+     * @brief Iterates the entities only.
+     *
+     * @param func void(Entity)
+     */
+    template<typename Func>
+    void each_entity(Func func) const {
+        if (!leading_) return;
+
+        for (auto first = leading_->begin(), last = leading_->end(); first != last; ++first) {
+            const auto entity = *first;
+            if (!others_contain(entity) || excluded(entity)) continue;
+            func(entity);
+        }
+    }
+
+private:
+    std::vector<BaseStorage *> pools_;
+    std::vector<const BaseStorage *> filter_;
+    BaseStorage *leading_;
+};
+
+using RuntimeView = BasicRuntimeView<Entity>;
+
+} // namespace entities
+} // namespace nodec
+
+#endif
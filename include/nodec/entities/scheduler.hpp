@@ -0,0 +1,367 @@
+#ifndef NODEC__ENTITIES__SCHEDULER_HPP_
+#define NODEC__ENTITIES__SCHEDULER_HPP_
+
+#include "../stopwatch.hpp"
+#include "../type_info.hpp"
+#include "registry.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace nodec {
+namespace entities {
+
+/**
+ * @brief Components a system reads.
+ */
+template<typename... Components>
+struct reads_t {};
+
+/**
+ * @brief Components a system writes.
+ */
+template<typename... Components>
+struct writes_t {};
+
+template<typename... Components>
+constexpr reads_t<Components...> reads{};
+
+template<typename... Components>
+constexpr writes_t<Components...> writes{};
+
+namespace internal {
+
+/**
+ * @brief The set of the components a system accesses, by the type seq index.
+ */
+struct SystemAccess {
+    std::vector<type_seq_index_type> reads;
+    std::vector<type_seq_index_type> writes;
+
+    //! The system may access anything, so it conflicts with all the others.
+    bool exclusive{false};
+
+    template<typename... Reads, typename... Writes>
+    static SystemAccess make(reads_t<Reads...>, writes_t<Writes...>) {
+        SystemAccess access;
+        access.reads = {type_id<std::remove_const_t<Reads>>().seq_index()...};
+        access.writes = {type_id<std::remove_const_t<Writes>>().seq_index()...};
+        std::sort(access.reads.begin(), access.reads.end());
+        std::sort(access.writes.begin(), access.writes.end());
+        return access;
+    }
+
+    static bool intersects(const std::vector<type_seq_index_type> &lhs, const std::vector<type_seq_index_type> &rhs) {
+        auto l = lhs.begin();
+        auto r = rhs.begin();
+        while (l != lhs.end() && r != rhs.end()) {
+            if (*l < *r) {
+                ++l;
+            } else if (*r < *l) {
+                ++r;
+            } else {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Checks if two systems must not run at the same time.
+     *
+     * They conflict if one writes a component the other reads or writes.
+     */
+    bool conflicts(const SystemAccess &other) const {
+        return exclusive || other.exclusive
+               || intersects(writes, other.writes)
+               || intersects(writes, other.reads)
+               || intersects(reads, other.writes);
+    }
+};
+
+} // namespace internal
+
+/**
+ * @brief Runs systems with declared component access, concurrently where they do not conflict.
+ *
+ * Each system declares the components it reads and writes. Every run builds a
+ * DAG from the registration order: a system depends on each earlier system it
+ * conflicts with. The systems whose dependencies have finished are submitted
+ * to the executor, so the non-conflicting ones run at the same time while the
+ * order of the conflicting ones is kept.
+ *
+ * The systems must not change the structure of the registry (create or destroy
+ * entities, emplace or remove components) while others run. Record such
+ * changes into BasicCommandBuffers and play them back after run().
+ *
+ * Each system is timed with a Stopwatch. The timings of the last run and its
+ * critical path tell which chain of systems bounds the frame.
+ *
+ * @code{.cpp}
+ * Scheduler scheduler;
+ * scheduler.add_system("physics", reads<Velocity>, writes<Position>, [](Registry &registry) { ... });
+ * scheduler.add_system("render", reads<Position, Mesh>, writes<>, [](Registry &registry) { ... });
+ * scheduler.run(registry, executor);
+ * @endcode
+ */
+template<typename Entity>
+class BasicScheduler {
+public:
+    using registry_type = BasicRegistry<Entity>;
+    using duration = Stopwatch::duration;
+
+    /**
+     * @brief Timing of a system in the last run.
+     */
+    struct SystemStats {
+        //! The time the system took.
+        duration elapsed{};
+
+        //! The start and the finish, from the start of the run.
+        duration start{};
+        duration finish{};
+    };
+
+private:
+    struct System {
+        std::string name;
+        internal::SystemAccess access;
+        std::function<void(registry_type &)> func;
+
+        //! Creates the pools of the declared components before the systems run concurrently.
+        void (*prepare)(registry_type &);
+
+        std::vector<std::size_t> dependencies;
+        std::vector<std::size_t> dependents;
+        SystemStats stats;
+    };
+
+    template<typename... Components>
+    static void prepare_pools(registry_type &registry) {
+        using Expander = int[];
+        (void)Expander{0, ((void)registry.template view<std::remove_const_t<Components>>(), 0)...};
+    }
+
+    void build_graph() {
+        for (auto &system : systems_) {
+            system.dependencies.clear();
+            system.dependents.clear();
+        }
+
+        for (std::size_t j = 0; j < systems_.size(); ++j) {
+            for (std::size_t i = 0; i < j; ++i) {
+                if (!systems_[i].access.conflicts(systems_[j].access)) continue;
+                systems_[j].dependencies.push_back(i);
+                systems_[i].dependents.push_back(j);
+            }
+        }
+    }
+
+    void run_system(System &system, registry_type &registry, const Stopwatch &frame) {
+        Stopwatch sw;
+        system.stats.start = frame.elapsed();
+        sw.restart();
+        system.func(registry);
+        system.stats.elapsed = sw.elapsed();
+        system.stats.finish = frame.elapsed();
+    }
+
+public:
+    /**
+     * @brief Adds a system with its component access.
+     *
+     * @param func void(registry_type &)
+     * @return The index of the system.
+     */
+    template<typename... Reads, typename... Writes, typename Func>
+    std::size_t add_system(std::string name, reads_t<Reads...> reads_list, writes_t<Writes...> writes_list, Func func) {
+        systems_.push_back({std::move(name),
+                            internal::SystemAccess::make(reads_list, writes_list),
+                            std::move(func),
+                            &prepare_pools<Reads..., Writes...>,
+                            {},
+                            {},
+                            {}});
+        return systems_.size() - 1;
+    }
+
+    /**
+     * @brief Adds a system which may access anything.
+     *
+     * It runs alone, after all the earlier systems and before all the later ones.
+     *
+     * @param func void(registry_type &)
+     * @return The index of the system.
+     */
+    template<typename Func>
+    std::size_t add_exclusive_system(std::string name, Func func) {
+        internal::SystemAccess access;
+        access.exclusive = true;
+        systems_.push_back({std::move(name), std::move(access), std::move(func), &prepare_pools<>, {}, {}, {}});
+        return systems_.size() - 1;
+    }
+
+    /**
+     * @brief Runs all the systems in the registration order on the calling thread.
+     */
+    void run(registry_type &registry) {
+        build_graph();
+
+        Stopwatch frame;
+        frame.restart();
+        for (auto &system : systems_) {
+            run_system(system, registry, frame);
+        }
+        frame_elapsed_ = frame.elapsed();
+    }
+
+    /**
+     * @brief Runs all the systems on the workers of an executor, and waits for them.
+     *
+     * If systems throw, the others still run, and the first exception is
+     * rethrown after all of them finished.
+     *
+     * @warning
+     * Do not call this from a worker of the same executor. The systems must not
+     * block on the same executor either (for example with each_parallel()),
+     * unless it has more workers than the systems which may run at once.
+     *
+     * @tparam Executor Executor type like concurrent::ThreadPoolExecutor.
+     */
+    template<typename Executor>
+    void run(registry_type &registry, Executor &executor) {
+        build_graph();
+        if (systems_.empty()) return;
+
+        for (auto &system : systems_) {
+            system.prepare(registry);
+        }
+
+        std::mutex mutex;
+        std::condition_variable finished;
+        std::vector<std::size_t> remaining(systems_.size());
+        std::size_t unfinished = systems_.size();
+        std::exception_ptr error;
+
+        Stopwatch frame;
+        frame.restart();
+
+        // The task resubmits the dependents which become ready.
+        std::function<void(std::size_t)> submit = [&](std::size_t index) {
+            executor.submit([&, index]() {
+                try {
+                    run_system(systems_[index], registry, frame);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!error) error = std::current_exception();
+                }
+
+                std::vector<std::size_t> ready;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    for (const auto dependent : systems_[index].dependents) {
+                        if (--remaining[dependent] == 0) ready.push_back(dependent);
+                    }
+                    --unfinished;
+                    if (unfinished == 0) finished.notify_all();
+                }
+
+                for (const auto dependent : ready) {
+                    submit(dependent);
+                }
+            });
+        };
+
+        std::vector<std::size_t> roots;
+        for (std::size_t i = 0; i < systems_.size(); ++i) {
+            remaining[i] = systems_[i].dependencies.size();
+            if (remaining[i] == 0) roots.push_back(i);
+        }
+        for (const auto root : roots) {
+            submit(root);
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [&] { return unfinished == 0; });
+        frame_elapsed_ = frame.elapsed();
+
+        if (error) std::rethrow_exception(error);
+    }
+
+    std::size_t system_count() const noexcept {
+        return systems_.size();
+    }
+
+    const std::string &system_name(const std::size_t index) const {
+        return systems_[index].name;
+    }
+
+    /**
+     * @brief Returns the timing of a system in the last run.
+     */
+    const SystemStats &system_stats(const std::size_t index) const {
+        return systems_[index].stats;
+    }
+
+    /**
+     * @brief Returns the earlier systems the system waited for in the last run.
+     */
+    const std::vector<std::size_t> &dependencies(const std::size_t index) const {
+        return systems_[index].dependencies;
+    }
+
+    /**
+     * @brief Returns the time the last run took.
+     */
+    duration frame_elapsed() const noexcept {
+        return frame_elapsed_;
+    }
+
+    /**
+     * @brief Returns the chain of the dependent systems with the longest total time in the last run.
+     */
+    std::vector<std::size_t> critical_path() const {
+        if (systems_.empty()) return {};
+
+        // The dependencies always precede the dependents, so one pass in the order is enough.
+        std::vector<duration> totals(systems_.size());
+        std::vector<std::size_t> previous(systems_.size(), systems_.size());
+        for (std::size_t i = 0; i < systems_.size(); ++i) {
+            duration longest{};
+            for (const auto dependency : systems_[i].dependencies) {
+                if (totals[dependency] > longest || previous[i] == systems_.size()) {
+                    longest = totals[dependency];
+                    previous[i] = dependency;
+                }
+            }
+            totals[i] = longest + systems_[i].stats.elapsed;
+        }
+
+        auto last = static_cast<std::size_t>(std::max_element(totals.begin(), totals.end()) - totals.begin());
+        std::vector<std::size_t> path;
+        for (; last != systems_.size(); last = previous[last]) {
+            path.push_back(last);
+        }
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+
+private:
+    std::vector<System> systems_;
+    duration frame_elapsed_{};
+};
+
+using Scheduler = BasicScheduler<Entity>;
+
+} // namespace entities
+} // namespace nodec
+
+#endif
@@ -0,0 +1,163 @@
+#ifndef NODEC__ENTITIES__SIGNATURE_HPP_
+#define NODEC__ENTITIES__SIGNATURE_HPP_
+
+#include <algorithm>
+#include <bitset>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace nodec {
+namespace entities {
+
+namespace internal {
+
+/**
+ * @brief Returns the index of the highest set bit of a non-zero word.
+ * @note Waiting for C++20 (and std::countl_zero).
+ */
+inline int highest_bit64(const std::uint64_t value) noexcept {
+    assert(value != 0);
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(value);
+#else
+    int pos = 63;
+    while (!(value & (std::uint64_t{1} << pos))) --pos;
+    return pos;
+#endif
+}
+
+} // namespace internal
+
+/**
+ * @brief Per-entity bitmask of the pools which contain the entity.
+ *
+ * The bit i of an entity is set while the pool at index i of the registry
+ * (the type seq index of the component) contains the entity. The masks of all
+ * the entities are laid out in one vector with a fixed stride of words, which
+ * is widened when a pool with a larger index is bound.
+ *
+ * The masks are indexed by the entity number, so the caller must check the
+ * version of the entity.
+ */
+class ComponentSignatures {
+    static constexpr std::size_t WORD_BITS = 64;
+
+    static std::uint64_t bit_mask(const std::size_t index) noexcept {
+        return std::uint64_t{1} << (index % WORD_BITS);
+    }
+
+public:
+    /**
+     * @brief Widens the masks to hold the bit at the given index.
+     */
+    void reserve_bit(const std::size_t index) {
+        const auto words_needed = index / WORD_BITS + 1;
+        if (!(stride_ < words_needed)) return;
+
+        const auto entity_count = stride_ ? words_.size() / stride_ : 0u;
+        std::vector<std::uint64_t> words(entity_count * words_needed);
+        for (std::size_t number = 0; number < entity_count; ++number) {
+            for (std::size_t i = 0; i < stride_; ++i) {
+                words[number * words_needed + i] = words_[number * stride_ + i];
+            }
+        }
+
+        words_.swap(words);
+        stride_ = words_needed;
+    }
+
+    void set(const std::size_t number, const std::size_t index) {
+        assert(index / WORD_BITS < stride_);
+
+        const auto offset = number * stride_;
+        if (!(offset < words_.size())) {
+            words_.resize(offset + stride_);
+        }
+        words_[offset + index / WORD_BITS] |= bit_mask(index);
+    }
+
+    void reset(const std::size_t number, const std::size_t index) noexcept {
+        const auto offset = number * stride_ + index / WORD_BITS;
+        if (offset < words_.size() && index / WORD_BITS < stride_) {
+            words_[offset] &= ~bit_mask(index);
+        }
+    }
+
+    bool test(const std::size_t number, const std::size_t index) const noexcept {
+        const auto offset = number * stride_ + index / WORD_BITS;
+        return index / WORD_BITS < stride_ && offset < words_.size() && (words_[offset] & bit_mask(index));
+    }
+
+    bool none(const std::size_t number) const noexcept {
+        const auto offset = number * stride_;
+        for (std::size_t i = 0; i < stride_ && offset + i < words_.size(); ++i) {
+            if (words_[offset + i]) return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Calls the function with the index of each set bit, from the highest.
+     *
+     * The mask is copied word by word before the calls, so the function may
+     * modify the masks. The offset of each word is computed again, as the
+     * function may widen the masks by binding a new pool. The words added by
+     * the widening are not visited.
+     *
+     * @param func void(std::size_t index)
+     */
+    template<typename Func>
+    void each_reverse(const std::size_t number, Func func) const {
+        for (auto i = stride_; i; --i) {
+            const auto offset = number * stride_ + i - 1;
+            if (!(offset < words_.size())) continue;
+
+            auto word = words_[offset];
+            while (word) {
+                const auto bit = internal::highest_bit64(word);
+                word &= ~(std::uint64_t{1} << bit);
+                func((i - 1) * WORD_BITS + static_cast<std::size_t>(bit));
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the bytes allocated for the masks.
+     */
+    std::size_t memory_usage() const noexcept {
+        return words_.capacity() * sizeof(std::uint64_t);
+    }
+
+    /**
+     * @brief Trims the trailing empty masks and releases the slack.
+     */
+    void shrink_to_fit() {
+        if (stride_ == 0) return;
+
+        auto size = words_.size();
+        while (size >= stride_ && std::all_of(words_.begin() + (size - stride_), words_.begin() + size,
+                                              [](const auto word) { return word == 0; })) {
+            size -= stride_;
+        }
+        words_.resize(size);
+        words_.shrink_to_fit();
+    }
+
+    /**
+     * @brief Returns the number of the 64 bits words per entity.
+     */
+    std::size_t stride() const noexcept {
+        return stride_;
+    }
+
+private:
+    std::vector<std::uint64_t> words_;
+    std::size_t stride_{0};
+};
+
+} // namespace entities
+} // namespace nodec
+
+#endif
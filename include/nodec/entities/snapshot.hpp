@@ -0,0 +1,436 @@
+#ifndef NODEC__ENTITIES__SNAPSHOT_HPP_
+#define NODEC__ENTITIES__SNAPSHOT_HPP_
+
+#include "../formatter.hpp"
+#include "../type_traits.hpp"
+#include "registry.hpp"
+#include "storage.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+namespace nodec {
+namespace entities {
+
+/**
+ * @brief Serializer of the components which are not trivially copyable.
+ *
+ * Specialize this to save and load such components with the snapshots.
+ *
+ * @code{.cpp}
+ * template<>
+ * struct nodec::entities::component_serializer<Name> {
+ *     static void save(std::ostream &stream, const Name &name);
+ *     static void load(std::istream &stream, Name &name);
+ * };
+ * @endcode
+ */
+template<typename Component, typename = void>
+struct component_serializer;
+
+namespace internal {
+
+template<typename Component, typename = void>
+struct has_component_serializer : std::false_type {};
+
+template<typename Component>
+struct has_component_serializer<Component, void_t<decltype(component_serializer<Component>::save)>>
+    : std::true_type {};
+
+inline void write_bytes(std::ostream &stream, const void *data, const std::size_t size) {
+    stream.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+    if (!stream) {
+        throw std::runtime_error(ErrorFormatter<std::runtime_error>(__FILE__, __LINE__)
+                                 << "Failed to write the snapshot.");
+    }
+}
+
+inline void read_bytes(std::istream &stream, void *data, const std::size_t size) {
+    stream.read(static_cast<char *>(data), static_cast<std::streamsize>(size));
+    if (!stream) {
+        throw std::runtime_error(ErrorFormatter<std::runtime_error>(__FILE__, __LINE__)
+                                 << "Failed to read the snapshot. The stream ended or is broken.");
+    }
+}
+
+inline void write_size(std::ostream &stream, const std::size_t size) {
+    const auto value = static_cast<std::uint64_t>(size);
+    write_bytes(stream, &value, sizeof(value));
+}
+
+inline std::size_t read_size(std::istream &stream) {
+    std::uint64_t value;
+    read_bytes(stream, &value, sizeof(value));
+    return static_cast<std::size_t>(value);
+}
+
+template<typename Component>
+using is_bulk_copyable = std::is_trivially_copyable<Component>;
+
+inline void write_u32(std::ostream &stream, const std::uint32_t value) {
+    write_bytes(stream, &value, sizeof(value));
+}
+
+inline std::uint32_t read_u32(std::istream &stream) {
+    std::uint32_t value;
+    read_bytes(stream, &value, sizeof(value));
+    return value;
+}
+
+//! "NDSS" in the little endian.
+constexpr std::uint32_t snapshot_magic = 0x5353444E;
+constexpr std::uint32_t snapshot_version = 1;
+
+enum class SnapshotEncoding : std::uint32_t {
+    none = 0,      //! The empty types. Only the entities are written.
+    bytes = 1,     //! The trivially copyable types, written as they are in memory.
+    serializer = 2 //! The types written by component_serializer.
+};
+
+/**
+ * @brief The header of a component section, which tells the layout of the values.
+ *
+ * A snapshot written by a build with another layout of the component fails to
+ * load, instead of loading garbage.
+ */
+template<typename Component>
+struct SnapshotSectionHeader {
+    static constexpr SnapshotEncoding encoding = std::is_empty<Component>::value      ? SnapshotEncoding::none
+                                                 : is_bulk_copyable<Component>::value ? SnapshotEncoding::bytes
+                                                                                      : SnapshotEncoding::serializer;
+    static constexpr std::uint32_t value_size = std::is_empty<Component>::value ? 0u : static_cast<std::uint32_t>(sizeof(Component));
+    static constexpr std::uint32_t value_alignment = static_cast<std::uint32_t>(alignof(Component));
+};
+
+inline void throw_snapshot_format_exception(const char *reason, const char *file, std::size_t line) {
+    throw std::runtime_error(ErrorFormatter<std::runtime_error>(file, line)
+                             << "The snapshot does not match this build. " << reason);
+}
+
+inline void throw_snapshot_broken_exception(const char *reason, const char *file, std::size_t line) {
+    throw std::runtime_error(ErrorFormatter<std::runtime_error>(file, line)
+                             << "The snapshot is broken. " << reason);
+}
+
+/**
+ * @brief Checks if the stream holds at least the given bytes past the read position.
+ *
+ * It is true if the stream cannot tell, like a stream which cannot seek.
+ */
+inline bool has_bytes(std::istream &stream, const std::size_t size) {
+    const auto pos = stream.tellg();
+    if (pos == std::istream::pos_type(-1)) return true;
+
+    stream.seekg(0, std::ios::end);
+    const auto end = stream.tellg();
+    stream.seekg(pos);
+    if (end == std::istream::pos_type(-1) || !stream) {
+        stream.clear();
+        stream.seekg(pos);
+        return true;
+    }
+    return static_cast<std::uint64_t>(end - pos) >= size;
+}
+
+/**
+ * @brief Reads count values, growing the buffer only as the stream delivers them.
+ *
+ * A broken count fails on the end of the stream instead of allocating it at once.
+ */
+template<typename T>
+void read_array(std::istream &stream, std::vector<T> &values, const std::size_t count) {
+    constexpr std::size_t min_chunk = 4096;
+
+    values.clear();
+    while (values.size() < count) {
+        const auto pos = values.size();
+        const auto n = (std::min)(count - pos, (std::max)(pos, min_chunk));
+        values.resize(pos + n);
+        read_bytes(stream, values.data() + pos, sizeof(T) * n);
+    }
+}
+
+template<typename Component>
+inline void throw_snapshot_section_exception(const char *file, std::size_t line) {
+    throw std::runtime_error(ErrorFormatter<std::runtime_error>(file, line)
+                             << "The snapshot section does not match the component {" << typeid(Component).name()
+                             << "}. The sections are loaded in another order, or the component has another layout.");
+}
+
+} // namespace internal
+
+/**
+ * @brief Writes the state of a registry into a binary stream.
+ *
+ * The sections must be loaded by BasicSnapshotLoader in the same order they
+ * were written. The data is in the native byte order of the host.
+ *
+ * Each section is a few contiguous blocks:
+ *
+ * * entities: magic, format version, entity size, count, the entity list, the head of the free list.
+ * * component: encoding, value size, value alignment, count, the packed entities, the values.
+ *
+ * The headers let the loader reject a snapshot written by another build, with
+ * another entity type or component layouts.
+ *
+ * The values of trivially copyable components are copied in one block as far as
+ * they are contiguous in the storage. The others go through component_serializer.
+ */
+template<typename Entity>
+class BasicSnapshot {
+    template<typename Component>
+    void component(std::ostream &stream) const {
+        using Header = internal::SnapshotSectionHeader<Component>;
+
+        const auto *pool = registry_->template pool_if_exists<Component>();
+        const std::size_t count = pool ? pool->size() : 0u;
+
+        internal::write_u32(stream, static_cast<std::uint32_t>(Header::encoding));
+        internal::write_u32(stream, Header::value_size);
+        internal::write_u32(stream, Header::value_alignment);
+        internal::write_size(stream, count);
+        if (count == 0) return;
+
+        internal::write_bytes(stream, pool->data(), sizeof(Entity) * count);
+
+        // The empty types have no values.
+        if constexpr (!std::is_empty<Component>::value) {
+            write_values(stream, *pool, count, internal::is_bulk_copyable<Component>{});
+        }
+    }
+
+    template<typename Storage>
+    static void write_values(std::ostream &stream, const Storage &pool, const std::size_t count, std::true_type) {
+        using Component = typename Storage::value_type;
+
+        if (std::is_same<instance_container_for_t<Component>, std::vector<Component>>::value) {
+            internal::write_bytes(stream, &pool.value_at(0), sizeof(Component) * count);
+            return;
+        }
+
+        for (std::size_t pos = 0; pos < count; ++pos) {
+            internal::write_bytes(stream, &pool.value_at(pos), sizeof(Component));
+        }
+    }
+
+    template<typename Storage>
+    static void write_values(std::ostream &stream, const Storage &pool, const std::size_t count, std::false_type) {
+        using Component = typename Storage::value_type;
+        static_assert(internal::has_component_serializer<Component>::value,
+                      "The component is not trivially copyable. Specialize component_serializer for it.");
+
+        for (std::size_t pos = 0; pos < count; ++pos) {
+            component_serializer<Component>::save(stream, pool.value_at(pos));
+        }
+    }
+
+public:
+    explicit BasicSnapshot(const BasicRegistry<Entity> &registry) noexcept
+        : registry_{&registry} {}
+
+    /**
+     * @brief Writes all the entities, including the released ones, and the free list.
+     */
+    const BasicSnapshot &entities(std::ostream &stream) const {
+        const auto &entities = registry_->entities;
+
+        internal::write_u32(stream, internal::snapshot_magic);
+        internal::write_u32(stream, internal::snapshot_version);
+        internal::write_u32(stream, static_cast<std::uint32_t>(sizeof(Entity)));
+        internal::write_size(stream, entities.size());
+        for (std::size_t page = 0, rest = entities.size(); rest > 0; ++page) {
+            const auto count = (std::min)(rest, entities.page_size);
+            internal::write_bytes(stream, entities.page_data(page), sizeof(Entity) * count);
+            rest -= count;
+        }
+        internal::write_bytes(stream, &registry_->free_list, sizeof(Entity));
+        return *this;
+    }
+
+    /**
+     * @brief Writes the given components, one section per type.
+     */
+    template<typename... Components>
+    const BasicSnapshot &components(std::ostream &stream) const {
+        using Expander = int[];
+        (void)Expander{0, (component<Components>(stream), 0)...};
+        return *this;
+    }
+
+private:
+    const BasicRegistry<Entity> *registry_;
+};
+
+/**
+ * @brief Restores the state of a registry from a binary stream written by BasicSnapshot.
+ *
+ * The components must be default constructible.
+ *
+ * The sections are checked against the layout of the components, and a
+ * mismatch throws std::runtime_error before anything of the section is loaded.
+ *
+ * The empty and the trivially copyable components in contiguous storage are
+ * read straight into an empty storage, and the packed and sparse sets are
+ * filled in the same pass (BasicStorage::insert_in_place()). The others are
+ * read into a buffer first, then inserted in bulk.
+ */
+template<typename Entity>
+class BasicSnapshotLoader {
+    template<typename Component>
+    void component(std::istream &stream) const {
+        using Header = internal::SnapshotSectionHeader<Component>;
+
+        const auto encoding = internal::read_u32(stream);
+        const auto value_size = internal::read_u32(stream);
+        const auto value_alignment = internal::read_u32(stream);
+        if (encoding != static_cast<std::uint32_t>(Header::encoding)
+            || value_size != Header::value_size || value_alignment != Header::value_alignment) {
+            internal::throw_snapshot_section_exception<Component>(__FILE__, __LINE__);
+        }
+
+        const auto count = internal::read_size(stream);
+        auto *pool = registry_->template pool_assured<Component>();
+        if (count == 0) return;
+
+        // Each entity of the section is a distinct valid one.
+        if (count > registry_->entities.size() || !internal::has_bytes(stream, sizeof(Entity) * count)) {
+            internal::throw_snapshot_broken_exception("The component count exceeds the data.", __FILE__, __LINE__);
+        }
+
+        const auto check = [this](const Entity entity) {
+            if (!registry_->is_valid(entity)) {
+                throw_invalid_entity_exception(entity, __FILE__, __LINE__);
+            }
+        };
+
+        using Storage = std::remove_pointer_t<decltype(pool)>;
+        if constexpr (Storage::is_in_place_insertable) {
+            if (pool->size() == 0 && !pool->owner()) {
+                pool->insert_in_place(count, [&](Entity *entities, Component *values) {
+                    internal::read_bytes(stream, entities, sizeof(Entity) * count);
+                    if constexpr (!std::is_empty<Component>::value) {
+                        internal::read_bytes(stream, values, sizeof(Component) * count);
+                    }
+                }, check);
+                return;
+            }
+        }
+
+        std::vector<Entity> packed;
+        internal::read_array(stream, packed, count);
+        for (const auto entity : packed) check(entity);
+
+        if constexpr (std::is_empty<Component>::value) {
+            pool->insert(packed.begin(), packed.end());
+        } else {
+            std::vector<Component> values(count);
+            read_values(stream, values.data(), count, internal::is_bulk_copyable<Component>{});
+
+            pool->insert(packed.begin(), packed.end(), values.begin());
+        }
+    }
+
+    template<typename Component>
+    static void read_values(std::istream &stream, Component *values, const std::size_t count, std::true_type) {
+        internal::read_bytes(stream, values, sizeof(Component) * count);
+    }
+
+    template<typename Component>
+    static void read_values(std::istream &stream, Component *values, const std::size_t count, std::false_type) {
+        static_assert(internal::has_component_serializer<Component>::value,
+                      "The component is not trivially copyable. Specialize component_serializer for it.");
+
+        for (std::size_t i = 0; i < count; ++i) {
+            component_serializer<Component>::load(stream, values[i]);
+        }
+    }
+
+public:
+    explicit BasicSnapshotLoader(BasicRegistry<Entity> &registry) noexcept
+        : registry_{&registry} {}
+
+    /**
+     * @brief Restores the entities and the free list.
+     *
+     * The section is read and checked before the registry is touched: each slot
+     * holds its own number while in use, and the released ones form the free list.
+     * If the stream is broken, it throws and the registry is left as it was.
+     * Otherwise all the components of the registry are removed, and the entity
+     * list is replaced in bulk.
+     */
+    const BasicSnapshotLoader &entities(std::istream &stream) const {
+        using traits_type = entity_traits<Entity>;
+
+        if (internal::read_u32(stream) != internal::snapshot_magic) {
+            internal::throw_snapshot_format_exception("It is not a snapshot.", __FILE__, __LINE__);
+        }
+        if (internal::read_u32(stream) != internal::snapshot_version) {
+            internal::throw_snapshot_format_exception("The format version differs.", __FILE__, __LINE__);
+        }
+        if (internal::read_u32(stream) != sizeof(Entity)) {
+            internal::throw_snapshot_format_exception("The entity size differs.", __FILE__, __LINE__);
+        }
+
+        // The last number is reserved for the null entity.
+        const auto count = internal::read_size(stream);
+        if (count > static_cast<std::size_t>(traits_type::entity_mask)
+            || !internal::has_bytes(stream, sizeof(Entity) * (count + 1))) {
+            internal::throw_snapshot_broken_exception("The entity count exceeds the data.", __FILE__, __LINE__);
+        }
+
+        std::vector<Entity> entities;
+        internal::read_array(stream, entities, count);
+
+        Entity free_list;
+        internal::read_bytes(stream, &free_list, sizeof(Entity));
+
+        // Each released slot holds the next number of the free list, so the list
+        // must visit all of them once, and nothing else.
+        std::size_t released = 0;
+        for (std::size_t pos = 0; pos < count; ++pos) {
+            if (traits_type::to_entity(entities[pos]) != pos) ++released;
+        }
+        std::size_t visited = 0;
+        for (auto curr = free_list; curr != null_entity; ++visited) {
+            const auto pos = static_cast<std::size_t>(traits_type::to_entity(curr));
+            if (!(pos < count) || traits_type::to_entity(entities[pos]) == pos || visited == released) {
+                internal::throw_snapshot_broken_exception("The free list is inconsistent.", __FILE__, __LINE__);
+            }
+            curr = entities[pos];
+        }
+        if (visited != released) {
+            internal::throw_snapshot_broken_exception("The free list is inconsistent.", __FILE__, __LINE__);
+        }
+
+        registry_->clear();
+        registry_->entities.assign(entities.begin(), entities.end());
+        registry_->free_list = free_list;
+        return *this;
+    }
+
+    /**
+     * @brief Restores the given components, one section per type, in the order they were written.
+     */
+    template<typename... Components>
+    const BasicSnapshotLoader &components(std::istream &stream) const {
+        using Expander = int[];
+        (void)Expander{0, (component<Components>(stream), 0)...};
+        return *this;
+    }
+
+private:
+    BasicRegistry<Entity> *registry_;
+};
+
+using Snapshot = BasicSnapshot<Entity>;
+using SnapshotLoader = BasicSnapshotLoader<Entity>;
+
+} // namespace entities
+} // namespace nodec
+
+#endif
@@ -1,15 +1,23 @@
 #ifndef NODEC__ENTITIES__STORAGE_HPP_
 #define NODEC__ENTITIES__STORAGE_HPP_
 
+#include "../algorithm.hpp"
+#include "../array_view.hpp"
+#include "../containers/paged_sparse_array.hpp"
+#include "../containers/paged_vector.hpp"
 #include "../containers/sparse_table.hpp"
 #include "../formatter.hpp"
 #include "../signals/signal.hpp"
 #include "../type_traits.hpp"
 #include "../utility.hpp"
 #include "entity.hpp"
+#include "exceptions.hpp"
+#include "signature.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <iterator>
+#include <numeric>
 #include <vector>
 
 namespace nodec {
@@ -135,10 +143,170 @@ constexpr bool operator>=(const StorageIterator<Container> &lhs, const StorageIt
 template<typename Entity>
 class BasicRegistry;
 
+/**
+ * @brief Entity-to-sparse-container conversion utility.
+ *
+ * The sparse container maps the entity numbers to the packed positions in the storages.
+ * By default, containers::PagedSparseArray is used, which gives O(1) direct indexing.
+ * Specialize this for the entity type to select another backend like
+ * containers::SparseTable<std::size_t>, which trades lookup speed for memory.
+ */
+template<typename Entity, typename = void>
+struct sparse_container_for {
+    using type = containers::PagedSparseArray<std::size_t>;
+};
+
+template<typename Entity>
+using sparse_container_for_t = typename sparse_container_for<Entity>::type;
+
+/**
+ * @brief Per-component customization of the storage.
+ *
+ * Specialize this for a component type to opt in:
+ *
+ * * page_size: If non-zero, the components are stored in containers::BasicPagedVector
+ *   with the given page size instead of std::vector. Growing the storage never
+ *   relocates the existing components, so their addresses stay stable across
+ *   emplace. They are stable only until an erase, though: removing a component
+ *   moves the last one into its slot, so the address of that one changes.
+ *   The components are not contiguous either, so BasicRuntimeView takes the
+ *   slower path on these pools, with a virtual call per entity.
+ *
+ * @code{.cpp}
+ * template<>
+ * struct nodec::entities::component_traits<Mesh> {
+ *     static constexpr std::size_t page_size = 1024;
+ * };
+ * @endcode
+ */
+template<typename Type, typename = void>
+struct component_traits {
+    static constexpr std::size_t page_size = 0;
+};
+
+namespace internal {
+
+/**
+ * @brief Instance container of the empty types, which holds nothing.
+ *
+ * An element is a prvalue constructed on access, so the storage of a tag
+ * component is just the packed and sparse sets.
+ */
+template<typename Value>
+class EmptyInstances {
+public:
+    Value operator[](const std::size_t) const noexcept {
+        return {};
+    }
+
+    void push_back(const Value &) noexcept {}
+
+    void pop_back() noexcept {}
+
+    void reserve(const std::size_t) noexcept {}
+
+    std::size_t capacity() const noexcept {
+        return 0;
+    }
+
+    void shrink_to_fit() noexcept {}
+};
+
+template<typename Value, std::size_t PageSize, bool Empty = std::is_empty<Value>::value>
+struct instance_container {
+    using type = containers::BasicPagedVector<Value, PageSize>;
+};
+
+template<typename Value>
+struct instance_container<Value, 0, false> {
+    using type = std::vector<Value>;
+};
+
+template<typename Value, std::size_t PageSize>
+struct instance_container<Value, PageSize, true> {
+    using type = EmptyInstances<Value>;
+};
+
+} // namespace internal
+
+/**
+ * @brief Component-to-instance-container conversion utility.
+ *
+ * The empty types (tags) have no instances at all.
+ */
+template<typename Type>
+using instance_container_for_t = typename internal::instance_container<Type, component_traits<Type>::page_size>::type;
+
+/**
+ * @brief Memory statistics of a storage.
+ */
+struct StorageStats {
+    //! The number of the entities in the storage.
+    std::size_t size{0};
+
+    //! The number of the entities the packed array can hold without reallocation.
+    std::size_t capacity{0};
+
+    std::size_t packed_bytes{0};
+    std::size_t instance_bytes{0};
+    std::size_t sparse_bytes{0};
+
+    //! The number of the slots allocated in the sparse container.
+    std::size_t sparse_capacity{0};
+
+    //! The bytes of the dirty set and the deferred event buffers.
+    std::size_t bookkeeping_bytes{0};
+
+    std::size_t total_bytes() const noexcept {
+        return packed_bytes + instance_bytes + sparse_bytes + bookkeeping_bytes;
+    }
+
+    /**
+     * @brief Returns the ratio of the used slots in the sparse container.
+     */
+    double sparse_occupancy() const noexcept {
+        return sparse_capacity ? static_cast<double>(size) / static_cast<double>(sparse_capacity) : 0.0;
+    }
+
+    StorageStats &operator+=(const StorageStats &other) noexcept {
+        size += other.size;
+        capacity += other.capacity;
+        packed_bytes += other.packed_bytes;
+        instance_bytes += other.instance_bytes;
+        sparse_bytes += other.sparse_bytes;
+        sparse_capacity += other.sparse_capacity;
+        bookkeeping_bytes += other.bookkeeping_bytes;
+        return *this;
+    }
+};
+
+/**
+ * @brief Interface of the object that owns a storage, like an owning group.
+ *
+ * The owner is notified directly by the storage, before the signals are emitted
+ * on construction and after they are emitted on destruction, so that the owner
+ * can keep the packed order of the storage consistent.
+ */
+template<typename Entity>
+class BaseStorageOwner {
+public:
+    virtual ~BaseStorageOwner() {}
+
+    /**
+     * @brief Called after an element is appended to the storage.
+     */
+    virtual void on_emplaced(const Entity entity) = 0;
+
+    /**
+     * @brief Called before an element is removed from the storage.
+     */
+    virtual void on_erasing(const Entity entity) = 0;
+};
+
 template<typename Entity>
 class BaseStorage {
     using PackedContainer = std::vector<Entity>;
-    using SparseTable = containers::SparseTable<size_t>;
+    using SparseTable = sparse_container_for_t<Entity>;
 
 public:
     using entity_type = Entity;
@@ -162,6 +330,23 @@ public:
         return registry_;
     }
 
+    void bind_owner(BaseStorageOwner<Entity> *owner) noexcept {
+        owner_ = owner;
+    }
+
+    BaseStorageOwner<Entity> *owner() const noexcept {
+        return owner_;
+    }
+
+    /**
+     * @brief Binds the signatures to keep the bit at the given index up to date.
+     */
+    void bind_signatures(ComponentSignatures *signatures, const std::size_t index) {
+        signatures_ = signatures;
+        signature_index_ = index;
+        if (signatures_) signatures_->reserve_bit(index);
+    }
+
     const_iterator begin() const noexcept {
         const auto pos = static_cast<typename iterator::difference_type>(packed_.size());
         return iterator{packed_, pos};
@@ -182,6 +367,40 @@ public:
         return packed_.size();
     }
 
+    /**
+     * @brief Returns the packed entity array.
+     */
+    const Entity *data() const noexcept {
+        return packed_.data();
+    }
+
+    /**
+     * @brief Returns the entity at the given packed position.
+     */
+    Entity at(const std::size_t pos) const noexcept {
+        assert(pos < packed_.size());
+        return packed_[pos];
+    }
+
+    /**
+     * @brief Returns the packed position of an entity.
+     *
+     * @warning
+     * The storage must contain the entity.
+     */
+    std::size_t index(const Entity entity) const {
+        assert(contains(entity));
+        return *sparse_table_.try_get(entity_traits_type::to_entity(entity));
+    }
+
+    /**
+     * @brief Returns the packed position of an entity, or null if the storage does not contain it.
+     */
+    const std::size_t *try_index(const Entity entity) const {
+        const auto *pos = sparse_table_.try_get(entity_traits_type::to_entity(entity));
+        return (pos && packed_[*pos] == entity) ? pos : nullptr;
+    }
+
     /**
      * @brief Checks if a storage contains an entity.
      */
@@ -196,6 +415,58 @@ public:
     virtual bool erase(const Entity entity) = 0;
     virtual void *try_get_opaque(const Entity entity) = 0;
 
+    /**
+     * @brief Returns the opaque pointer to the value at the given packed position.
+     */
+    virtual void *opaque_at(const std::size_t pos) noexcept = 0;
+
+    /**
+     * @brief Returns the opaque pointer to the contiguous values, or null if they are not contiguous.
+     *
+     * The value at the packed position pos is at (pos * value_size()) bytes from it.
+     * It is null for the empty types and the paged storages (component_traits::page_size),
+     * whose values must be reached by opaque_at() one by one.
+     */
+    virtual void *opaque_data() noexcept = 0;
+
+    virtual std::size_t value_size() const noexcept = 0;
+
+    /**
+     * @brief Switches the deferred event mode.
+     *
+     * In the deferred mode, the storage appends the constructed/destroyed entities
+     * to its event buffers instead of emitting the element signals, and
+     * flush_events() emits them in batches.
+     */
+    virtual void set_events_deferred(bool deferred) = 0;
+
+    /**
+     * @brief Emits the buffered events in batches.
+     */
+    virtual void flush_events() = 0;
+
+    virtual bool has_pending_events() const noexcept = 0;
+
+    virtual StorageStats stats() const noexcept = 0;
+
+    /**
+     * @brief Assigns copies of the value of the prototype to the entities in a range.
+     *
+     * The construction events of the copies are delivered as one batch: buffered
+     * in the deferred mode, otherwise emitted at once through the batch signal.
+     *
+     * @return The number of the objects actually constructed.
+     * @throw std::runtime_error If the value is not copy constructible.
+     */
+    virtual std::size_t clone(const Entity prototype, const Entity *first, const Entity *last) = 0;
+
+    /**
+     * @brief Releases the slack of the packed array, the instances and the sparse container.
+     *
+     * The packed order and the values are kept.
+     */
+    virtual void shrink_to_fit() = 0;
+
     template<typename It>
     std::size_t erase(It first, It last) {
         std::size_t count{};
@@ -219,7 +490,21 @@ private:
     //! Conversion table from entity to packed index.
     SparseTable &sparse_table_;
 
-    BasicRegistry<Entity> *registry_;
+    BasicRegistry<Entity> *registry_{nullptr};
+
+    BaseStorageOwner<Entity> *owner_{nullptr};
+
+    ComponentSignatures *signatures_{nullptr};
+    std::size_t signature_index_{0};
+
+protected:
+    void signature_set(const Entity entity) {
+        if (signatures_) signatures_->set(entity_traits_type::to_entity(entity), signature_index_);
+    }
+
+    void signature_reset(const Entity entity) noexcept {
+        if (signatures_) signatures_->reset(entity_traits_type::to_entity(entity), signature_index_);
+    }
 };
 
 template<typename Entity, typename Value>
@@ -228,8 +513,10 @@ class BasicStorage : public BaseStorage<Entity> {
                   "The managed value must be at least move constructible and move assignable.");
 
     using StorageSignal = signals::Signal<void(BasicRegistry<Entity> &, const Entity)>;
+    using StorageBatchSignal = signals::Signal<void(BasicRegistry<Entity> &, ArrayView<const Entity>)>;
 
     using Base = BaseStorage<Entity>;
+    using InstanceContainer = instance_container_for_t<Value>;
 
 public:
     // like stl.
@@ -237,6 +524,16 @@ public:
     using entity_type = Entity;
     using base_type = Base;
 
+    /**
+     * @brief The type returned by get().
+     *
+     * The empty types have no instances, so it is a prvalue for them.
+     */
+    using reference = decltype(std::declval<InstanceContainer &>()[0]);
+    using const_reference = decltype(std::declval<const InstanceContainer &>()[0]);
+
+    static constexpr bool is_empty_value = std::is_empty<Value>::value;
+
 public:
     BasicStorage()
         : Base{packed_, sparse_table_} {}
@@ -250,7 +547,7 @@ public:
      * The version of the given entity that already exists must match the one in storage.
      */
     template<typename... Args>
-    std::pair<value_type &, bool> emplace(const Entity entity, Args &&...args) {
+    std::pair<reference, bool> emplace(const Entity entity, Args &&...args) {
         const auto entity_number = Base::entity_traits_type::to_entity(entity);
 
         {
@@ -261,47 +558,299 @@ public:
             }
         }
 
-        auto pos = instances_.size();
-        sparse_table_[entity_number] = pos;
+        sparse_table_[entity_number] = packed_.size();
         instances_.push_back({args...});
         packed_.emplace_back(entity);
+        this->signature_set(entity);
+
+        if (auto *owner = this->owner()) {
+            owner->on_emplaced(entity);
+        }
+
+        notify_constructed(entity);
 
-        element_constructed_(*this->registry(), entity);
+        // The owner may have moved the element.
+        return {instances_[*sparse_table_.try_get(entity_number)], true};
+    }
+
+    /**
+     * @brief Assigns the entities in a range to the storage and constructs their
+     * objects by copying the given value.
+     *
+     * The packed and instance storage are reserved once, and the sparse pages are
+     * allocated only for the pages the entities fall in. The construction signals
+     * are emitted after all the objects are constructed: element_constructed()
+     * for each entity, then elements_constructed() with all of them. The
+     * entities that already exist in the storage are skipped.
+     *
+     * @return The number of the objects actually constructed.
+     */
+    template<typename It>
+    std::size_t insert(It first, It last, const value_type &value = {}) {
+        // The value may be an element of this storage, which the growth moves.
+        const value_type copy = value;
+        return insert_with(first, last, [&copy](const Entity) -> const value_type & { return copy; });
+    }
 
-        return {instances_[pos], true};
+    /**
+     * @brief Assigns the entities in a range to the storage and constructs their
+     * objects by copying the values from another range.
+     *
+     * The value range must have at least as many elements as the entity range.
+     * A value is consumed for each entity, including the skipped ones. The
+     * signals are emitted as by the insert() with a value.
+     *
+     * @return The number of the objects actually constructed.
+     */
+    template<typename It, typename CIt,
+             typename = std::enable_if_t<std::is_same<std::decay_t<typename std::iterator_traits<CIt>::value_type>, value_type>::value>>
+    std::size_t insert(It first, It last, CIt from) {
+        return insert_with(first, last, [&from](const Entity) -> decltype(auto) { return *from++; });
     }
 
+    /**
+     * @brief Whether insert_in_place() supports the type: the empty types, and the
+     * trivially copyable types in contiguous storage.
+     */
+    static constexpr bool is_in_place_insertable = is_empty_value
+                                                   || (std::is_trivially_copyable<Value>::value
+                                                       && std::is_default_constructible<Value>::value
+                                                       && std::is_same<InstanceContainer, std::vector<Value>>::value);
+
+    /**
+     * @brief Appends the entities and the objects a reader writes straight into the storage.
+     *
+     * It is meant for the bulk loading like BasicSnapshotLoader. The values are
+     * not copied, and the sparse indices and the signatures are filled in one
+     * pass over the new entities. The construction signals are emitted in one batch.
+     *
+     * If an entity is rejected by the check or is already in the storage, the
+     * storage is restored as it was and the exception is propagated.
+     *
+     * @param count The number of the entities.
+     * @param read void(Entity *entities, value_type *values), which writes count
+     *   entities and count objects. The values are null for the empty types.
+     * @param check void(Entity), which throws for an entity not to be inserted.
+     * @return The number of the objects constructed.
+     */
+    template<typename Read, typename Check>
+    std::size_t insert_in_place(const std::size_t count, Read read, Check check) {
+        static_assert(is_in_place_insertable, "The objects cannot be written in place. Use insert() instead.");
+
+        const auto first_pos = packed_.size();
+        packed_.resize(first_pos + count);
+        if constexpr (!is_empty_value) instances_.resize(first_pos + count);
+
+        auto pos = first_pos;
+        try {
+            value_type *values = nullptr;
+            if constexpr (!is_empty_value) values = instances_.data() + first_pos;
+            read(packed_.data() + first_pos, values);
+
+            for (; pos < packed_.size(); ++pos) {
+                const auto entity = packed_[pos];
+                check(entity);
+                if (this->contains(entity)) {
+                    throw_invalid_entity_exception(entity, __FILE__, __LINE__);
+                }
+                sparse_table_[Base::entity_traits_type::to_entity(entity)] = pos;
+                this->signature_set(entity);
+            }
+        } catch (...) {
+            for (auto i = first_pos; i < pos; ++i) {
+                this->signature_reset(packed_[i]);
+                sparse_table_.erase(Base::entity_traits_type::to_entity(packed_[i]));
+            }
+            packed_.resize(first_pos);
+            if constexpr (!is_empty_value) instances_.resize(first_pos);
+            throw;
+        }
+
+        return notify_inserted(first_pos);
+    }
+
+    /**
+     * @brief Returns the pointer to the object of the entity, or nullptr.
+     *
+     * The empty types have no instances, so the pointer refers to an instance
+     * shared by all the entities.
+     */
     const value_type *try_get(const Entity entity) const {
         const auto *pos = sparse_table_.try_get(Base::entity_traits_type::to_entity(entity));
         if (!pos) return nullptr;
 
         assert(packed_[*pos] == entity);
 
-        return &instances_[*pos];
+        if constexpr (is_empty_value) {
+            static value_type shared{};
+            return &shared;
+        } else {
+            return &instances_[*pos];
+        }
     }
 
     value_type *try_get(const Entity entity) {
-        return const_cast<value_type *>(as_const(*this).try_get(entity));
+        return const_cast<value_type *>(nodec::as_const(*this).try_get(entity));
     }
 
-    const value_type &get(const Entity entity) const {
-        const auto *pos = sparse_table_.try_get(Base::entity_traits_type::to_entity(entity));
-        assert(pos != nullptr);
-        assert(packed_[*pos] == entity);
+    const_reference get(const Entity entity) const {
+        return instances_[this->index(entity)];
+    }
 
-        return instances_[*pos];
+    reference get(const Entity entity) {
+        return instances_[this->index(entity)];
     }
 
-    value_type &get(const Entity entity) {
-        return const_cast<value_type &>(as_const(*this).get(entity));
+    std::tuple<const_reference> get_as_tuple(const Entity entity) const {
+        return std::tuple<const_reference>(get(entity));
     }
 
-    std::tuple<const value_type &> get_as_tuple(const Entity entity) const {
-        return std::forward_as_tuple(get(entity));
+    std::tuple<reference> get_as_tuple(const Entity entity) {
+        return std::tuple<reference>(get(entity));
     }
 
-    std::tuple<value_type &> get_as_tuple(const Entity entity) {
-        return std::forward_as_tuple(get(entity));
+    /**
+     * @brief Returns the value at the given packed position.
+     */
+    const_reference value_at(const std::size_t pos) const noexcept {
+        assert(pos < packed_.size());
+        return instances_[pos];
+    }
+
+    reference value_at(const std::size_t pos) noexcept {
+        assert(pos < packed_.size());
+        return instances_[pos];
+    }
+
+    /**
+     * @brief Swaps two elements by their packed positions, and updates the sparse table.
+     */
+    void swap_elements(const std::size_t lhs, const std::size_t rhs) {
+        assert(lhs < packed_.size() && rhs < packed_.size());
+        if (lhs == rhs) return;
+
+        using std::swap;
+        if constexpr (!is_empty_value) {
+            swap(instances_[lhs], instances_[rhs]);
+        }
+        swap(packed_[lhs], packed_[rhs]);
+
+        sparse_table_[Base::entity_traits_type::to_entity(packed_[lhs])] = lhs;
+        sparse_table_[Base::entity_traits_type::to_entity(packed_[rhs])] = rhs;
+    }
+
+    /**
+     * @brief Marks the element of the entity as changed.
+     *
+     * The dirty entities are kept until they are taken with take_dirty() or
+     * cleared. The erased elements are unmarked.
+     *
+     * @return false if the entity is not in the storage.
+     */
+    bool mark_dirty(const Entity entity) {
+        if (!this->contains(entity)) return false;
+
+        const auto entity_number = Base::entity_traits_type::to_entity(entity);
+        if (dirty_index_.contains(entity_number)) return true;
+
+        dirty_index_[entity_number] = dirty_.size();
+        dirty_.push_back(entity);
+        return true;
+    }
+
+    bool is_dirty(const Entity entity) const noexcept {
+        const auto *index = dirty_index_.try_get(Base::entity_traits_type::to_entity(entity));
+        return index && dirty_[*index] == entity;
+    }
+
+    /**
+     * @brief Returns the dirty entities.
+     */
+    ArrayView<const Entity> dirty() const noexcept {
+        return {dirty_.data(), dirty_.size()};
+    }
+
+    /**
+     * @brief Moves the dirty entities into the given vector and clears the dirty set.
+     *
+     * The entities marked after this are collected in the emptied set, so the
+     * caller can mark elements while processing the taken ones.
+     */
+    void take_dirty(std::vector<Entity> &out) {
+        for (const auto entity : dirty_) {
+            dirty_index_.erase(Base::entity_traits_type::to_entity(entity));
+        }
+        out.clear();
+        out.swap(dirty_);
+    }
+
+    void clear_dirty() {
+        for (const auto entity : dirty_) {
+            dirty_index_.erase(Base::entity_traits_type::to_entity(entity));
+        }
+        dirty_.clear();
+    }
+
+    /**
+     * @brief Sorts the elements by their entities, so that they are iterated in the given order.
+     *
+     * The signature of the comparison function object should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * bool(const Entity, const Entity);
+     * @endcode
+     *
+     * The packed entities and the values are permuted together, and the sparse
+     * table is updated. Pass InsertionSort as the algorithm to keep nearly sorted
+     * storages sorted cheaply, e.g. every frame.
+     *
+     * @warning
+     * The storage owned by a group cannot be sorted.
+     */
+    template<typename Compare, typename Sort = StdSort>
+    void sort(Compare compare, Sort algorithm = Sort{}) {
+        sort_positions(algorithm, [&](const std::size_t lhs, const std::size_t rhs) {
+            return compare(nodec::as_const(packed_[lhs]), nodec::as_const(packed_[rhs]));
+        });
+    }
+
+    /**
+     * @brief Sorts the elements by their values, so that they are iterated in the given order.
+     *
+     * The signature of the comparison function object should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * bool(const Value &, const Value &);
+     * @endcode
+     *
+     * @see sort()
+     */
+    template<typename Compare, typename Sort = StdSort>
+    void sort_by_value(Compare compare, Sort algorithm = Sort{}) {
+        sort_positions(algorithm, [&](const std::size_t lhs, const std::size_t rhs) {
+            return compare(nodec::as_const(*this).value_at(lhs), nodec::as_const(*this).value_at(rhs));
+        });
+    }
+
+    /**
+     * @brief Sorts the elements to follow the order of another storage.
+     *
+     * The entities shared with the other storage come first in its iteration
+     * order. The rest follow in no particular order.
+     */
+    void sort_as(const Base &other) {
+        if (this->owner()) {
+            throw_owned_pool_sort_exception<Value>(__FILE__, __LINE__);
+        }
+
+        // The storages are iterated from the back.
+        auto target = packed_.size();
+        for (auto it = other.begin(), end = other.end(); it != end && target > 0; ++it) {
+            const auto *pos = sparse_table_.try_get(Base::entity_traits_type::to_entity(*it));
+            if (!pos || packed_[*pos] != *it) continue;
+
+            swap_elements(*pos, --target);
+        }
     }
 
 public:
@@ -311,10 +860,81 @@ public:
         return try_get(entity);
     }
 
+    void *opaque_at(const std::size_t pos) noexcept override {
+        if constexpr (is_empty_value) {
+            return try_get(this->at(pos));
+        } else {
+            return &instances_[pos];
+        }
+    }
+
+    void *opaque_data() noexcept override {
+        if constexpr (!is_empty_value && std::is_same<InstanceContainer, std::vector<Value>>::value) {
+            return instances_.data();
+        } else {
+            return nullptr;
+        }
+    }
+
+    std::size_t value_size() const noexcept override {
+        return sizeof(Value);
+    }
+
+    StorageStats stats() const noexcept override {
+        StorageStats stats;
+        stats.size = packed_.size();
+        stats.capacity = packed_.capacity();
+        stats.packed_bytes = packed_.capacity() * sizeof(Entity);
+        stats.instance_bytes = is_empty_value ? 0u : instances_.capacity() * sizeof(Value);
+        stats.sparse_bytes = sparse_table_.memory_usage();
+        stats.sparse_capacity = sparse_table_.capacity();
+        stats.bookkeeping_bytes = (dirty_.capacity() + constructed_events_.capacity() + destroyed_events_.capacity() + inserted_buffer_.capacity()) * sizeof(Entity)
+                                  + dirty_index_.memory_usage() + constructed_index_.memory_usage();
+        return stats;
+    }
+
+    std::size_t clone(const Entity prototype, const Entity *first, const Entity *last) override {
+        if constexpr (!std::is_copy_constructible<Value>::value) {
+            throw_component_not_copyable_exception<Value>(__FILE__, __LINE__);
+            return 0;
+        } else {
+            const auto *value = try_get(prototype);
+            if (!value) return 0;
+
+            return insert(first, last, *value);
+        }
+    }
+
+    void shrink_to_fit() override {
+        packed_.shrink_to_fit();
+        instances_.shrink_to_fit();
+        sparse_table_.shrink_to_fit();
+
+        dirty_.shrink_to_fit();
+        dirty_index_.shrink_to_fit();
+        constructed_index_.shrink_to_fit();
+        constructed_events_.shrink_to_fit();
+        destroyed_events_.shrink_to_fit();
+        inserted_buffer_ = {};
+    }
+
+    /**
+     * @brief Removes the entity and destroys its object.
+     *
+     * The last object is moved into the slot of the removed one. So the address
+     * of that object changes, also in the paged storages.
+     */
     bool erase(const Entity entity) override {
         if (!this->contains(entity)) return false;
 
-        element_destroyed_(*this->registry(), entity); // cause structural changes.
+        notify_destroyed(entity); // cause structural changes, unless the events are deferred.
+
+        if (auto *owner = this->owner()) {
+            owner->on_erasing(entity);
+        }
+
+        unmark_dirty(entity);
+        this->signature_reset(entity);
 
         const auto entity_number = Base::entity_traits_type::to_entity(entity);
         auto *pos = sparse_table_.try_get(entity_number);
@@ -325,7 +945,9 @@ public:
         packed_[*pos] = other_entity;
         packed_.pop_back();
 
-        instances_[*pos] = std::move(instances_.back());
+        if constexpr (!is_empty_value) {
+            instances_[*pos] = std::move(instances_.back());
+        }
         instances_.pop_back();
 
         // Updates the location of other entity.
@@ -338,6 +960,227 @@ public:
     using Base::clear;
     using Base::erase;
 
+private:
+    void unmark_dirty(const Entity entity) {
+        const auto entity_number = Base::entity_traits_type::to_entity(entity);
+        const auto *index = dirty_index_.try_get(entity_number);
+        if (!index) return;
+
+        const auto pos = *index;
+        const auto last = dirty_.back();
+        dirty_[pos] = last;
+        dirty_index_[Base::entity_traits_type::to_entity(last)] = pos;
+        dirty_.pop_back();
+        dirty_index_.erase(entity_number);
+    }
+
+    template<typename Sort, typename Compare>
+    void sort_positions(Sort &algorithm, Compare compare) {
+        if (this->owner()) {
+            throw_owned_pool_sort_exception<Value>(__FILE__, __LINE__);
+        }
+
+        std::vector<std::size_t> order(packed_.size());
+        std::iota(order.begin(), order.end(), std::size_t{0});
+
+        // The storage is iterated from the back.
+        algorithm(order.rbegin(), order.rend(), std::move(compare));
+
+        apply_order(order);
+    }
+
+    /**
+     * @brief Moves the element at order[pos] to pos for each position, following the cycles.
+     */
+    void apply_order(std::vector<std::size_t> &order) {
+        for (std::size_t pos = 0; pos < order.size(); ++pos) {
+            auto curr = pos;
+            while (order[curr] != pos) {
+                const auto next = order[curr];
+                swap_elements(curr, next);
+                order[curr] = curr;
+                curr = next;
+            }
+            order[curr] = curr;
+        }
+    }
+
+    template<typename It, typename Generator>
+    std::size_t insert_with(It first, It last, Generator generator) {
+        const auto count = static_cast<std::size_t>(std::distance(first, last));
+        const auto first_pos = packed_.size();
+
+        // The sparse pages are allocated on demand, only for the pages the entities touch.
+        packed_.reserve(first_pos + count);
+        instances_.reserve(first_pos + count);
+
+        for (; first != last; ++first) {
+            const auto entity = *first;
+            const auto &value = generator(entity);
+            if (this->contains(entity)) continue;
+
+            sparse_table_[Base::entity_traits_type::to_entity(entity)] = packed_.size();
+            instances_.push_back(value);
+            packed_.push_back(entity);
+            this->signature_set(entity);
+        }
+
+        return notify_inserted(first_pos);
+    }
+
+    /**
+     * @brief Hands the entities appended from first_pos to the owner, and emits their construction.
+     *
+     * @return The number of the appended entities.
+     */
+    std::size_t notify_inserted(const std::size_t first_pos) {
+        const auto inserted_count = packed_.size() - first_pos;
+        if (inserted_count == 0) return 0;
+
+        if (events_deferred_ && !this->owner()) {
+            for (auto pos = first_pos; pos < packed_.size(); ++pos) {
+                buffer_constructed(packed_[pos]);
+            }
+            return inserted_count;
+        }
+
+        // The owner may move the elements and the listeners may change the storage,
+        // so take the new entities first. The buffer is detached while in use, as a
+        // listener may insert again.
+        std::vector<Entity> inserted;
+        inserted.swap(inserted_buffer_);
+        inserted.assign(packed_.begin() + first_pos, packed_.end());
+
+        if (auto *owner = this->owner()) {
+            for (const auto entity : inserted) owner->on_emplaced(entity);
+        }
+
+        if (events_deferred_) {
+            for (const auto entity : inserted) buffer_constructed(entity);
+        } else {
+            // The per-entity listeners are told as with emplace(). Skip the loop if there are none.
+            if (!element_constructed_.empty()) {
+                for (const auto entity : inserted) {
+                    element_constructed_(*this->registry(), entity);
+                }
+            }
+            elements_constructed_(*this->registry(), ArrayView<const Entity>(inserted.data(), inserted.size()));
+        }
+
+        // Reuse the capacity.
+        inserted.clear();
+        if (inserted_buffer_.capacity() < inserted.capacity()) inserted_buffer_.swap(inserted);
+
+        return inserted_count;
+    }
+
+    void notify_constructed(const Entity entity) {
+        if (events_deferred_) {
+            buffer_constructed(entity);
+        } else {
+            element_constructed_(*this->registry(), entity);
+        }
+    }
+
+    void notify_destroyed(const Entity entity) {
+        // The listeners have not been told of the component yet, so they are told of neither.
+        if (cancel_constructed(entity)) return;
+
+        if (events_deferred_) {
+            destroyed_events_.push_back(entity);
+        } else {
+            element_destroyed_(*this->registry(), entity);
+        }
+    }
+
+    void buffer_constructed(const Entity entity) {
+        constructed_index_[Base::entity_traits_type::to_entity(entity)] = constructed_events_.size();
+        constructed_events_.push_back(entity);
+    }
+
+    /**
+     * @brief Removes the buffered constructed event of the entity, if any.
+     */
+    bool cancel_constructed(const Entity entity) {
+        const auto entity_number = Base::entity_traits_type::to_entity(entity);
+        const auto *index = constructed_index_.try_get(entity_number);
+        if (!index) return false;
+
+        const auto pos = *index;
+        const auto last = constructed_events_.back();
+        constructed_events_[pos] = last;
+        constructed_index_[Base::entity_traits_type::to_entity(last)] = pos;
+        constructed_events_.pop_back();
+        constructed_index_.erase(entity_number);
+        return true;
+    }
+
+    static void flush_buffer(std::vector<Entity> &buffer, StorageBatchSignal &signal, BasicRegistry<Entity> &registry) {
+        // The listeners may cause new events, so emit the buffered ones from a detached buffer.
+        std::vector<Entity> events;
+        events.swap(buffer);
+        signal(registry, ArrayView<const Entity>(events.data(), events.size()));
+
+        // Reuse the capacity.
+        events.clear();
+        if (buffer.empty()) buffer.swap(events);
+    }
+
+public:
+    void set_events_deferred(bool deferred) override {
+        events_deferred_ = deferred;
+    }
+
+    bool events_deferred() const noexcept {
+        return events_deferred_;
+    }
+
+    /**
+     * @brief Emits the buffered events in batches.
+     *
+     * The buffers hold the net changes since the last flush. A component
+     * constructed and destroyed before the flush cancels out, and is in neither
+     * batch. So each destroyed entity had the component before the buffering,
+     * and each constructed entity has it at the flush.
+     *
+     * The destroyed events are emitted before the constructed events, so a
+     * component destroyed and then constructed again is seen in that order. The
+     * order of the entities in a batch is not specified. It repeats until no more
+     * events are buffered, so events caused by the listeners are also emitted.
+     */
+    void flush_events() override {
+        while (!constructed_events_.empty() || !destroyed_events_.empty()) {
+            if (!destroyed_events_.empty()) {
+                flush_buffer(destroyed_events_, elements_destroyed_, *this->registry());
+            }
+            if (!constructed_events_.empty()) {
+                // The listeners may buffer the same entities again.
+                for (const auto entity : constructed_events_) {
+                    constructed_index_.erase(Base::entity_traits_type::to_entity(entity));
+                }
+                flush_buffer(constructed_events_, elements_constructed_, *this->registry());
+            }
+        }
+    }
+
+    bool has_pending_events() const noexcept override {
+        return !constructed_events_.empty() || !destroyed_events_.empty();
+    }
+
+    /**
+     * @brief Returns the buffered constructed entities not yet flushed.
+     */
+    ArrayView<const Entity> pending_constructed_events() const noexcept {
+        return {constructed_events_.data(), constructed_events_.size()};
+    }
+
+    /**
+     * @brief Returns the buffered destroyed entities not yet flushed.
+     */
+    ArrayView<const Entity> pending_destroyed_events() const noexcept {
+        return {destroyed_events_.data(), destroyed_events_.size()};
+    }
+
 public:
     decltype(auto) element_constructed() {
         return element_constructed_.signal_interface();
@@ -347,13 +1190,49 @@ public:
         return element_destroyed_.signal_interface();
     }
 
+    /**
+     * @brief Returns the signal interface emitted with the buffered constructed
+     * entities in the deferred event mode, and with the entities appended by
+     * insert(), clone() and insert_in_place().
+     *
+     * Outside of the deferred event mode, these bulk insertions emit
+     * element_constructed() for each entity too, before the batch.
+     */
+    decltype(auto) elements_constructed() {
+        return elements_constructed_.signal_interface();
+    }
+
+    /**
+     * @brief Returns the signal interface emitted with the buffered destroyed
+     * entities in the deferred event mode.
+     */
+    decltype(auto) elements_destroyed() {
+        return elements_destroyed_.signal_interface();
+    }
+
 private:
-    containers::SparseTable<size_t> sparse_table_;
+    sparse_container_for_t<Entity> sparse_table_;
     std::vector<Entity> packed_;
-    std::vector<Value> instances_;
+    InstanceContainer instances_;
 
     StorageSignal element_constructed_;
     StorageSignal element_destroyed_;
+
+    bool events_deferred_{false};
+    std::vector<Entity> constructed_events_;
+    std::vector<Entity> destroyed_events_;
+
+    //! The conversion table from entity to the index in the constructed events.
+    containers::PagedSparseArray<std::size_t> constructed_index_;
+    StorageBatchSignal elements_constructed_;
+    StorageBatchSignal elements_destroyed_;
+
+    //! The entities inserted by the last bulk insertion, kept for the capacity.
+    std::vector<Entity> inserted_buffer_;
+
+    //! The changed entities and the conversion table from entity to the index in it.
+    std::vector<Entity> dirty_;
+    containers::PagedSparseArray<std::size_t> dirty_index_;
 };
 
 /**
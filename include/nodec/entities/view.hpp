@@ -6,7 +6,10 @@
 
 #include <algorithm>
 #include <array>
+#include <exception>
+#include <future>
 #include <iterator>
+#include <vector>
 
 namespace nodec {
 namespace entities {
@@ -123,6 +126,69 @@ class BasicView<type_list<Storages...>, type_list<Exclusions...>> {
             std::get<Exclusions *>(filter)...};
     }
 
+    template<std::size_t Leading, std::size_t... Is>
+    bool others_contain(const Entity entt, std::index_sequence<Is...>) const {
+        return ((Is == Leading || std::get<Is>(pools)->contains(entt)) && ...);
+    }
+
+    bool excluded([[maybe_unused]] const Entity entt) const {
+        return (std::get<Exclusions *>(filter)->contains(entt) || ...);
+    }
+
+    /**
+     * @brief Returns the component of the I-th pool.
+     *
+     * The leading pool reads it at the packed position, without a sparse lookup.
+     */
+    template<std::size_t Leading, std::size_t I>
+    decltype(auto) component_at(const Entity entt, const std::size_t pos) const {
+        using Storage = type_list_element_t<I, type_list<Storages...>>;
+
+        // The empty types have no instances, so skip the lookup.
+        if constexpr (Storage::is_empty_value) {
+            return typename Storage::value_type{};
+        } else if constexpr (I == Leading) {
+            return std::get<I>(pools)->value_at(pos);
+        } else {
+            return std::get<I>(pools)->get(entt);
+        }
+    }
+
+    template<std::size_t Leading, typename Func, std::size_t... Is>
+    void each_in_leading(typename BaseStorage::const_iterator first, const typename BaseStorage::const_iterator last,
+                         Func &func, std::index_sequence<Is...> seq) const {
+        for (; first != last; ++first) {
+            const auto entt = *first;
+            if ((sizeof...(Storages) == 1u && entt == tombstone_entity)
+                || !others_contain<Leading>(entt, seq) || excluded(entt)) {
+                continue;
+            }
+
+            const auto pos = static_cast<std::size_t>(first.index());
+            func(entt, component_at<Leading, Is>(entt, pos)...);
+        }
+    }
+
+    /**
+     * @brief Iterates the packed range of the leading pool.
+     *
+     * The loop is instantiated once per possible leading pool, so the checks on
+     * the other pools are unrolled on their concrete types.
+     */
+    template<typename Func, std::size_t... Is>
+    void each_in(const typename BaseStorage::const_iterator first, const typename BaseStorage::const_iterator last,
+                 Func &func, std::index_sequence<Is...> seq) const {
+        using Expander = int[];
+        (void)Expander{0, (static_cast<const BaseStorage *>(std::get<Is>(pools)) == base_storage
+                               ? (each_in_leading<Is>(first, last, func, seq), 0)
+                               : 0)...};
+    }
+
+    template<typename Func>
+    void each_in(const typename BaseStorage::const_iterator first, const typename BaseStorage::const_iterator last, Func &func) const {
+        each_in(first, last, func, std::index_sequence_for<Storages...>{});
+    }
+
 public:
     // like-stl.
     using iterator = internal::ViewIterator<BaseStorage, sizeof...(Storages) - 1u, sizeof...(Exclusions)>;
@@ -168,9 +234,77 @@ public:
      */
     template<typename Func>
     void each(Func func) const {
-        for (const auto entt : *this) {
-            func(entt, [&](auto *pool) -> decltype(auto) { return pool->get(entt); }(std::get<Storages *>(pools))...);
+        each_in(base_storage->begin(), base_storage->end(), func);
+    }
+
+    /**
+     * @brief Iterates the view in parallel on the workers of an executor.
+     *
+     * The packed range of the leading (smallest) pool is split into chunks of
+     * @p grain entities. All chunks but the last one are submitted to the
+     * executor, the last one is processed on the calling thread, and the
+     * function returns once every chunk has been processed. If the function
+     * object throws, the first exception is rethrown after all chunks joined.
+     *
+     * The function object is called concurrently, so it must be safe to invoke
+     * from several threads at once. Each entity is visited exactly once, which
+     * gives the following contract for component access:
+     *
+     * * Writing the components passed for the current entity is safe.
+     * * Reading components of other entities is safe only if no chunk writes them.
+     * * Structural changes (creating or destroying entities, emplacing or
+     *   removing components) are not allowed and must be deferred until the
+     *   function returns.
+     *
+     * @warning
+     * Do not call this from a worker of the same executor. The calling thread
+     * blocks until the submitted chunks complete.
+     *
+     * @tparam Executor Executor type like concurrent::ThreadPoolExecutor.
+     * @param func void(Entity, Components&...)
+     * @param grain The number of entities per chunk.
+     */
+    template<typename Executor, typename Func>
+    void each_parallel(Executor &executor, Func func, std::size_t grain = 1024u) const {
+        using difference_type = typename BaseStorage::const_iterator::difference_type;
+
+        const auto first = base_storage->begin();
+        const auto size = base_storage->size();
+        if (grain == 0u) grain = 1u;
+
+        if (size <= grain) {
+            each_in(first, base_storage->end(), func);
+            return;
+        }
+
+        std::vector<std::future<void>> futures;
+        futures.reserve((size - 1u) / grain);
+
+        std::size_t offset = 0u;
+        for (; offset + grain < size; offset += grain) {
+            const auto chunk_first = first + static_cast<difference_type>(offset);
+            const auto chunk_last = first + static_cast<difference_type>(offset + grain);
+            futures.emplace_back(executor.submit([this, &func, chunk_first, chunk_last]() {
+                each_in(chunk_first, chunk_last, func);
+            }));
         }
+
+        std::exception_ptr error;
+        try {
+            each_in(first + static_cast<difference_type>(offset), base_storage->end(), func);
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        for (auto &future : futures) {
+            try {
+                future.get();
+            } catch (...) {
+                if (!error) error = std::current_exception();
+            }
+        }
+
+        if (error) std::rethrow_exception(error);
     }
 
 private:
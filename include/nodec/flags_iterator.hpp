@@ -11,7 +11,7 @@ class Flags;
 template<class E>
 class FlagsIterator {
 public:
-    using Flags = Flags<E>;
+    using Flags = nodec::Flags<E>;
     using impl_type = typename Flags::impl_type;
 
     using difference_type = std::ptrdiff_t;
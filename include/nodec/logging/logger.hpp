@@ -3,33 +3,33 @@
 
 #include <atomic>
 #include <memory>
-#include <mutex>
 #include <sstream>
 #include <vector>
 
 #include "../macros.hpp"
 #include "../optional.hpp"
-#include "../signals/signal.hpp"
+#include "../signals/concurrent_signal.hpp"
 #include "../string_builder.hpp"
 #include "log_record.hpp"
 
 namespace nodec {
 namespace logging {
 
+/**
+ * @brief Keeps a handler added to a logger, and removes it on destruction.
+ *
+ * The destruction waits for the handler calls running on the other threads,
+ * so the handler is not running once it returns. Only when it is destroyed
+ * during a handler call on the same thread, it does not wait, and the calls
+ * already running on the other threads may still finish.
+ */
 class HandlerConnection {
 public:
-    HandlerConnection(signals::Connection &&connection, std::mutex &handlers_mutex)
-        : conn_(std::move(connection)), handlers_mutex_(&handlers_mutex) {}
-
-    ~HandlerConnection() {
-        std::lock_guard<std::mutex> lock(*handlers_mutex_);
-        conn_.reset();
-    }
+    HandlerConnection(signals::Connection &&connection)
+        : conn_(std::move(connection)) {}
 
     HandlerConnection(HandlerConnection &&other) noexcept
-        : conn_(std::move(other.conn_)), handlers_mutex_(other.handlers_mutex_) {
-        other.handlers_mutex_ = nullptr;
-    }
+        : conn_(std::move(other.conn_)) {}
 
     /**
      * @brief Blocks the connection.
@@ -48,7 +48,6 @@ public:
 
 private:
     optional<signals::Connection> conn_;
-    std::mutex *handlers_mutex_;
     NODEC_DISABLE_COPY(HandlerConnection)
 };
 
@@ -56,10 +55,8 @@ class Logger {
 private:
     void handle(const LogRecord &record) {
         if (record.level < level_) return;
-        {
-            std::lock_guard<std::mutex> lock(handlers_mutex_);
-            handlers_(record);
-        }
+        // The handlers are read from a snapshot, so the threads logging at once do not serialize.
+        handlers_(record);
         if (parent_) {
             parent_->handle(record);
         }
@@ -105,15 +102,13 @@ public:
 
     template<typename Handler>
     HandlerConnection add_handler(Handler &&handler) {
-        std::lock_guard<std::mutex> lock(handlers_mutex_);
         signals::Connection conn_raw = handlers_.signal_interface().connect(std::move(handler));
-        return HandlerConnection{std::move(conn_raw), handlers_mutex_};
+        return HandlerConnection{std::move(conn_raw)};
     }
 
     template<typename Handler>
     void add_handler(std::shared_ptr<Handler> handler) {
         if (!handler) return;
-        std::lock_guard<std::mutex> lock(handlers_mutex_);
         handlers_.signal_interface().connect([handler](const LogRecord &record) {
             (*handler)(record);
         });
@@ -196,8 +191,7 @@ private:
     std::atomic<Level> level_{Level::Unset};
     std::shared_ptr<Logger> parent_;
 
-    std::mutex handlers_mutex_;
-    signals::Signal<void(const LogRecord &)> handlers_;
+    signals::ConcurrentSignal<void(const LogRecord &)> handlers_;
 
     NODEC_DISABLE_COPY(Logger)
 };
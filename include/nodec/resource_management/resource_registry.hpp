@@ -62,7 +62,7 @@ class ResourceRegistry {
 public:
     template<typename Type>
     class LoadNotifyer {
-        using ResourceBlock = ResourceBlock<Type>;
+        using ResourceBlock = ResourceRegistry::ResourceBlock<Type>;
 
     public:
         LoadNotifyer(ResourceBlock *block)
@@ -0,0 +1,384 @@
+#ifndef NODEC__SIGNALS__CONCURRENT_SIGNAL_HPP_
+#define NODEC__SIGNALS__CONCURRENT_SIGNAL_HPP_
+
+#include "../delegate.hpp"
+#include "signal.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace nodec {
+namespace signals {
+
+namespace details {
+
+/**
+ * @brief Counts the emitters which may still read a retired slot list.
+ *
+ * The counter is striped over cache lines, and each thread takes one stripe,
+ * so the emitters on different threads do not write the same line.
+ *
+ * Each stripe has a count per phase. An emitter enters the count of the current
+ * phase, and synchronize() flips the phase before waiting, so the emitters
+ * which start during the wait do not hold it back.
+ */
+class ReaderCounter {
+    static constexpr std::size_t STRIPE_COUNT = 8;
+
+    struct alignas(64) Stripe {
+        std::atomic<std::size_t> counts[2]{};
+    };
+
+    static std::size_t stripe_index() noexcept {
+        static std::atomic<std::size_t> next{0};
+        thread_local const std::size_t index = next.fetch_add(1, std::memory_order_relaxed) % STRIPE_COUNT;
+        return index;
+    }
+
+    static std::size_t &emission_depth() noexcept {
+        thread_local std::size_t depth = 0;
+        return depth;
+    }
+
+public:
+    class Guard {
+    public:
+        Guard(ReaderCounter &counter) noexcept {
+            const auto phase = counter.phase_.load(std::memory_order_seq_cst) & 1u;
+            count_ = &counter.stripes_[stripe_index()].counts[phase];
+            count_->fetch_add(1, std::memory_order_seq_cst);
+            ++emission_depth();
+        }
+
+        ~Guard() {
+            --emission_depth();
+            count_->fetch_sub(1, std::memory_order_release);
+        }
+
+        Guard(const Guard &) = delete;
+        Guard &operator=(const Guard &) = delete;
+
+    private:
+        std::atomic<std::size_t> *count_;
+    };
+
+    /**
+     * @brief Checks if the current thread runs an emission of any concurrent signal.
+     */
+    static bool in_emission() noexcept {
+        return emission_depth() > 0;
+    }
+
+    /**
+     * @brief Waits until the emitters which entered before the call have left.
+     *
+     * Both phases are waited in turn, so an emitter is waited whichever phase it
+     * entered. Once it returns, no emitter holds the lists retired before the call.
+     *
+     * It must not be called during an emission on the same thread, which would wait on itself.
+     */
+    void synchronize() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (int flip = 0; flip < 2; ++flip) {
+            const auto phase = phase_.fetch_add(1, std::memory_order_seq_cst) & 1u;
+            for (auto &stripe : stripes_) {
+                while (stripe.counts[phase].load(std::memory_order_seq_cst) != 0) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    }
+
+private:
+    std::atomic<std::size_t> phase_{0};
+    Stripe stripes_[STRIPE_COUNT];
+
+    // Serializes the waiters, so the phase does not flip under a wait.
+    std::mutex mutex_;
+};
+
+template<typename>
+class ConcurrentSignalState;
+
+template<typename... Args>
+class ConcurrentSignalState<void(Args...)> {
+public:
+    using Callback = Delegate<void(Args...)>;
+
+    struct Slot {
+        Slot(Callback callback)
+            : callback(std::move(callback)) {}
+
+        const Callback callback;
+        std::atomic<bool> blocked{false};
+    };
+
+    using SlotList = std::vector<std::shared_ptr<Slot>>;
+
+    class ConnectionImpl final : public BaseConnectionImpl {
+    public:
+        ConnectionImpl(std::weak_ptr<ConcurrentSignalState> state, std::shared_ptr<Slot> slot)
+            : state_(std::move(state)), slot_(std::move(slot)) {}
+
+        ~ConnectionImpl() {
+            if (auto state = state_.lock()) state->disconnect(this);
+        }
+
+        void block() override {
+            slot_->blocked.store(true, std::memory_order_relaxed);
+        }
+
+        void unblock() override {
+            slot_->blocked.store(false, std::memory_order_relaxed);
+        }
+
+        void mark_owned() noexcept override {
+            has_owner_ = true;
+        }
+
+        bool has_owner() const noexcept {
+            return has_owner_;
+        }
+
+        const Slot *slot() const noexcept {
+            return slot_.get();
+        }
+
+    private:
+        std::weak_ptr<ConcurrentSignalState> state_;
+        std::shared_ptr<Slot> slot_;
+        bool has_owner_{false};
+    };
+
+    ConcurrentSignalState()
+        : current_{new SlotList()} {}
+
+    ~ConcurrentSignalState() {
+        delete current_.load(std::memory_order_relaxed);
+        for (auto *list : retired_) delete list;
+    }
+
+    /**
+     * @brief Calls the slots of the current snapshot. Wait-free.
+     */
+    void emit(Args... args) {
+        ReaderCounter::Guard guard(readers_);
+
+        const auto *slots = current_.load(std::memory_order_seq_cst);
+        for (const auto &slot : *slots) {
+            if (slot->blocked.load(std::memory_order_relaxed)) continue;
+            slot->callback(args...);
+        }
+    }
+
+    template<typename Func>
+    ConnectionImpl *connect(const std::shared_ptr<ConcurrentSignalState> &self, Func &&functor) {
+        auto slot = std::make_shared<Slot>(Callback(std::forward<Func>(functor)));
+
+        ConnectionImpl *connection;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            connection = new ConnectionImpl(self, slot);
+            connections_.push_back(connection);
+
+            auto *slots = new SlotList(*current_.load(std::memory_order_relaxed));
+            slots->push_back(std::move(slot));
+            retire(slots);
+        }
+        reclaim();
+        return connection;
+    }
+
+    /**
+     * @brief Removes the slot of the connection.
+     *
+     * Once it returns, the callback of the slot is not running on any thread,
+     * unless it is called during an emission of a concurrent signal on the current
+     * thread. In that case it does not wait, as the emission may be the callback
+     * itself, or another thread may wait on it.
+     */
+    void disconnect(ConnectionImpl *connection) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            const auto found = std::find(connections_.begin(), connections_.end(), connection);
+            if (found == connections_.end()) return;
+            connections_.erase(found);
+
+            const auto *current = current_.load(std::memory_order_relaxed);
+            auto *slots = new SlotList();
+            slots->reserve(current->size());
+            std::copy_if(current->begin(), current->end(), std::back_inserter(*slots),
+                         [&](const auto &slot) { return slot.get() != connection->slot(); });
+            retire(slots);
+        }
+        reclaim();
+    }
+
+    /**
+     * @brief Returns the number of the retired lists not freed yet.
+     */
+    std::size_t retired_size() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return retired_.size();
+    }
+
+    /**
+     * @brief Detaches all the connections for the destruction of the signal.
+     *
+     * @return The connections not owned by the clients, to be deleted by the caller.
+     */
+    std::vector<ConnectionImpl *> release_connections() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<ConnectionImpl *> unowned;
+        for (auto *connection : connections_) {
+            if (!connection->has_owner()) unowned.push_back(connection);
+        }
+        connections_.clear();
+        return unowned;
+    }
+
+private:
+    /**
+     * @brief Publishes the new snapshot, and keeps the old one until the emitters leave it.
+     */
+    void retire(SlotList *slots) {
+        retired_.push_back(current_.exchange(slots, std::memory_order_seq_cst));
+    }
+
+    /**
+     * @brief Waits for the emitters, and frees the lists retired until now.
+     *
+     * The wait is done out of the lock, so the callbacks of the emitters may
+     * still connect and disconnect. A change made during an emission leaves its
+     * list to the next change made outside of one, or to the destruction.
+     */
+    void reclaim() {
+        if (ReaderCounter::in_emission()) return;
+
+        std::vector<SlotList *> retired;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            retired.swap(retired_);
+        }
+
+        readers_.synchronize();
+        for (auto *list : retired) delete list;
+    }
+
+    std::atomic<SlotList *> current_;
+    ReaderCounter readers_;
+
+    // The writers are serialized. The emitters never take it.
+    std::mutex mutex_;
+    std::vector<SlotList *> retired_;
+    std::vector<ConnectionImpl *> connections_;
+};
+
+} // namespace details
+
+template<typename>
+class ConcurrentSignal;
+
+/**
+ * @brief Signal which can be emitted from many threads at once, while others connect and disconnect.
+ *
+ * The slots are kept in an immutable snapshot published atomically (copy-on-write).
+ * The emitters read the current snapshot without a lock and without waiting.
+ * A connect or a disconnect copies the snapshot under a mutex, so the changes pay
+ * the cost instead of the emissions.
+ *
+ * A change waits for the emitters which may still read the old snapshot, then
+ * frees it. So once a connection is disconnected (or destroyed), its callback
+ * is not running on any thread. The exception is a change made during an
+ * emission of a concurrent signal on the same thread: it does not wait, to
+ * avoid waiting on itself or on a thread waiting on it, and its snapshot is
+ * freed by the next change made outside of an emission.
+ *
+ * A callback may connect and disconnect slots, including its own, while it
+ * runs. The change takes effect from the next emission. Blocking a connection
+ * takes effect on the emissions which reach the slot afterwards.
+ *
+ * It works with the same Connection objects as Signal.
+ */
+template<typename... Args>
+class ConcurrentSignal<void(Args...)> final {
+    using State = details::ConcurrentSignalState<void(Args...)>;
+
+public:
+    class SignalInterface final {
+    public:
+        SignalInterface(std::shared_ptr<State> state)
+            : state_(std::move(state)) {}
+
+        template<class Func>
+        RawConnection connect(Func &&functor) {
+            return {state_->connect(state_, std::forward<Func>(functor))};
+        }
+
+        template<auto Candidate>
+        RawConnection connect() {
+            return connect(State::Callback::template bind<Candidate>());
+        }
+
+        template<auto Candidate, typename Type>
+        RawConnection connect(Type &instance) {
+            return connect(State::Callback::template bind<Candidate>(&instance));
+        }
+
+    private:
+        std::shared_ptr<State> state_;
+    };
+
+    ConcurrentSignal()
+        : state_(std::make_shared<State>()) {}
+
+    ~ConcurrentSignal() {
+        release();
+    }
+
+    ConcurrentSignal(ConcurrentSignal &&other) noexcept
+        : state_(std::move(other.state_)) {}
+
+    ConcurrentSignal &operator=(ConcurrentSignal &&other) noexcept {
+        if (this != &other) {
+            release();
+            state_ = std::move(other.state_);
+        }
+        return *this;
+    }
+
+    ConcurrentSignal(const ConcurrentSignal &) = delete;
+    ConcurrentSignal &operator=(const ConcurrentSignal &) = delete;
+
+    SignalInterface signal_interface() {
+        return {state_};
+    }
+
+    void operator()(Args... args) const {
+        state_->emit(args...);
+    }
+
+private:
+    void release() {
+        if (!state_) return;
+
+        auto unowned = state_->release_connections();
+        state_.reset();
+        for (auto *connection : unowned) {
+            delete connection;
+        }
+    }
+
+    std::shared_ptr<State> state_;
+};
+
+} // namespace signals
+} // namespace nodec
+
+#endif
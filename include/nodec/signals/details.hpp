@@ -1,8 +1,11 @@
 #ifndef NODEC__SIGNALS__DETAILS_HPP_
 #define NODEC__SIGNALS__DETAILS_HPP_
 
+#include "../delegate.hpp"
+
 #include <cassert>
-#include <functional>
+#include <cstddef>
+#include <new>
 #include <vector>
 
 namespace nodec {
@@ -10,6 +13,80 @@ namespace signals {
 
 namespace details {
 
+/**
+ * @brief Per-thread free list of the memory blocks of the connections.
+ *
+ * The connections of all the signatures have the same size, so they share the
+ * blocks. A block released on another thread joins the list of that thread.
+ */
+template<std::size_t BlockSize>
+class ConnectionPool {
+    static_assert(BlockSize >= sizeof(void *), "The block must hold the link of the free list.");
+
+    static constexpr std::size_t MAX_CACHED_BLOCKS = 1024;
+
+    struct FreeBlock {
+        FreeBlock *next;
+    };
+
+    // Trivially destructible, so it stays usable while the other thread locals are destroyed.
+    struct State {
+        FreeBlock *head;
+        std::size_t count;
+        bool finalized;
+    };
+
+    struct Finalizer {
+        ~Finalizer() {
+            auto &state = ConnectionPool::state();
+            while (state.head) {
+                auto *block = state.head;
+                state.head = block->next;
+                ::operator delete(block);
+            }
+            state.count = 0;
+            state.finalized = true;
+        }
+    };
+
+    static State &state() noexcept {
+        thread_local State instance{nullptr, 0, false};
+        return instance;
+    }
+
+    //! Registers the release of the cached blocks at the thread exit.
+    static void register_finalizer() noexcept {
+        thread_local Finalizer finalizer;
+        (void)finalizer;
+    }
+
+public:
+    static void *allocate() {
+        auto &pool = state();
+        if (!pool.head) return ::operator new(BlockSize);
+
+        auto *block = pool.head;
+        pool.head = block->next;
+        --pool.count;
+        return block;
+    }
+
+    static void deallocate(void *ptr) noexcept {
+        auto &pool = state();
+        if (pool.finalized || pool.count >= MAX_CACHED_BLOCKS) {
+            ::operator delete(ptr);
+            return;
+        }
+
+        // A thread may only release the connections made by the others.
+        register_finalizer();
+
+        auto *block = ::new (ptr) FreeBlock{pool.head};
+        pool.head = block;
+        ++pool.count;
+    }
+};
+
 class BaseConnectionImpl {
 public:
     virtual ~BaseConnectionImpl() {}
@@ -25,22 +102,54 @@ class SignalImpl;
 template<typename... Args>
 class SignalImpl<void(Args...)> final {
 public:
-    using Callback = std::function<void(Args...)>;
+    using Callback = Delegate<void(Args...)>;
+
+private:
+    Callback &slot(std::size_t index) {
+        return index < slots_.size() ? slots_[index] : pending_slots_[index - slots_.size()];
+    }
+
+    //! Checks the slots of the blocked and the released connections. Only needed while some are skipped.
+    bool skipped(std::size_t index) const {
+        return !connections_[index] || connections_[index]->blocked();
+    }
 
 public:
     class ConnectionImpl final : public BaseConnectionImpl {
+        // The vtable pointer, the signal, the index and the flags.
+        static constexpr std::size_t BLOCK_SIZE = sizeof(void *) * 4;
+        using Pool = ConnectionPool<BLOCK_SIZE>;
+
     public:
         ConnectionImpl(SignalImpl *signal, std::size_t index)
             : signal_(signal), index_(index) {}
 
         ~ConnectionImpl() {
             if (signal_) {
-                signal_->callbacks_[index_] = nullptr;
+                if (blocked_) --signal_->skipped_count_;
+
+                if (signal_->calling_) {
+                    // The callback may be running, so it is released by the compaction after the call.
+                    ++signal_->skipped_count_;
+                } else {
+                    signal_->slot(index_) = nullptr;
+                }
                 signal_->connections_[index_] = nullptr;
                 signal_->dirty_ = true;
             }
         }
 
+        static void *operator new(std::size_t size) {
+            static_assert(sizeof(ConnectionImpl) <= BLOCK_SIZE, "The pool block is too small for the connection.");
+            assert(size <= BLOCK_SIZE);
+            (void)size;
+            return Pool::allocate();
+        }
+
+        static void operator delete(void *ptr) noexcept {
+            Pool::deallocate(ptr);
+        }
+
         void set_signal(SignalImpl *signal) {
             signal_ = signal;
         }
@@ -52,17 +161,21 @@ public:
         void block() override {
             assert(signal_ && "Signal instance already have been deleted. The block/unblock function should be called in the callback.");
 
-            if (swapped_callback_) return;
-
-            std::swap(swapped_callback_, signal_->callbacks_[index_]);
+            if (blocked_) return;
+            blocked_ = true;
+            ++signal_->skipped_count_;
         }
 
         void unblock() override {
             assert(signal_ && "Signal instance already have been deleted. The block/unblock function should be called in the callback.");
 
-            if (!swapped_callback_) return;
+            if (!blocked_) return;
+            blocked_ = false;
+            --signal_->skipped_count_;
+        }
 
-            std::swap(swapped_callback_, signal_->callbacks_[index_]);
+        bool blocked() const noexcept {
+            return blocked_;
         }
 
         void mark_owned() noexcept override {
@@ -80,9 +193,61 @@ public:
         //! This instance is owned by the client not signal.
         bool has_owner_{false};
 
-        Callback swapped_callback_;
+        bool blocked_{false};
+    };
+
+private:
+    /**
+     * @brief Finishes the outermost call, even if a callback throws.
+     */
+    class CallScope {
+    public:
+        CallScope(SignalImpl &signal)
+            : signal_(signal), recursion_(signal.calling_) {
+            signal_.calling_ = true;
+        }
+
+        ~CallScope() {
+            if (recursion_) return;
+            signal_.calling_ = false;
+            if (signal_.dirty_ || !signal_.pending_slots_.empty()) signal_.post_process();
+        }
+
+    private:
+        SignalImpl &signal_;
+        bool recursion_;
     };
 
+    void post_process() {
+        // The slots connected while calling join now, since the callbacks could not be moved while running.
+        for (auto &pending : pending_slots_) {
+            slots_.push_back(std::move(pending));
+        }
+        pending_slots_.clear();
+
+        if (!dirty_) return;
+        dirty_ = false;
+
+        // Forget the released slots skipped while calling.
+        skipped_count_ = 0;
+        for (const auto *connection : connections_) {
+            if (connection && connection->blocked()) ++skipped_count_;
+        }
+
+        // Remove all empty slots while patching the store index in the connection.
+        size_t sz = 0;
+        for (size_t i = 0, n = connections_.size(); i < n; ++i) {
+            if (connections_[i] == nullptr) continue;
+
+            connections_[sz] = connections_[i];
+            if (sz != i) slots_[sz] = std::move(slots_[i]);
+            connections_[sz]->set_index(sz);
+            ++sz;
+        }
+        connections_.resize(sz);
+        slots_.resize(sz);
+    }
+
 public:
     SignalImpl() {}
 
@@ -102,8 +267,10 @@ public:
     SignalImpl &operator=(const SignalImpl &) = delete;
 
     SignalImpl(SignalImpl &&other) noexcept
-        : callbacks_(std::move(other.callbacks_)),
+        : slots_(std::move(other.slots_)),
+          pending_slots_(std::move(other.pending_slots_)),
           connections_(std::move(other.connections_)),
+          skipped_count_(other.skipped_count_),
           dirty_(other.dirty_) {
         assert(!calling_ && "You attempted to move the signal while calling. Reconsider your design.");
 
@@ -116,8 +283,10 @@ public:
     SignalImpl &operator=(SignalImpl &&other) noexcept {
         assert(!calling_ && "You attempted to move the signal while calling. Reconsider your design.");
 
-        callbacks_ = std::move(other.callbacks_);
+        slots_ = std::move(other.slots_);
+        pending_slots_ = std::move(other.pending_slots_);
         connections_ = std::move(other.connections_);
+        skipped_count_ = other.skipped_count_;
         dirty_ = other.dirty_;
 
         for (auto *connection : connections_) {
@@ -131,46 +300,44 @@ public:
     template<class Func>
     ConnectionImpl *connect(Func &&functor) {
         const auto index = connections_.size();
-        callbacks_.emplace_back(functor);
+        auto &slots = calling_ ? pending_slots_ : slots_;
+        slots.emplace_back(std::forward<Func>(functor));
         auto *connection = new ConnectionImpl(this, index);
         connections_.emplace_back(connection);
         return connection;
     }
 
+    /**
+     * @brief Checks if no connection is alive, so an emission would call nothing.
+     */
+    bool empty() const noexcept {
+        for (const auto *connection : connections_) {
+            if (connection) return false;
+        }
+        return true;
+    }
+
     void operator()(Args... args) {
-        bool recursion = calling_;
-        calling_ = true;
+        CallScope scope(*this);
 
-        for (std::size_t i = 0, n = callbacks_.size(); i < n; ++i) {
-            const auto &callback = callbacks_[i];
-            if (!callback) continue;
+        for (std::size_t i = 0, n = slots_.size(); i < n; ++i) {
+            const auto &callback = slots_[i];
+            if (!callback || (skipped_count_ != 0 && skipped(i))) continue;
             callback(std::forward<Args>(args)...);
         }
+    }
 
-        // --- Post process ---
-        if (recursion) return;
-        calling_ = false;
+private:
+    std::vector<Callback> slots_;
 
-        if (!dirty_) return;
-        dirty_ = false;
+    //! The slots connected while calling.
+    std::vector<Callback> pending_slots_;
 
-        // Remove all empty slots while patching the store index in the connection.
-        size_t sz = 0;
-        for (size_t i = 0, n = connections_.size(); i < n; ++i) {
-            if (connections_[i] == nullptr) continue;
+    std::vector<ConnectionImpl *> connections_;
 
-            connections_[sz] = connections_[i];
-            callbacks_[sz] = callbacks_[i];
-            connections_[sz]->set_index(sz);
-            ++sz;
-        }
-        connections_.resize(sz);
-        callbacks_.resize(sz);
-    }
+    //! The number of the blocked connections and the released slots waiting for the compaction.
+    std::size_t skipped_count_{0};
 
-private:
-    std::vector<Callback> callbacks_;
-    std::vector<ConnectionImpl *> connections_;
     bool dirty_{false};
     bool calling_{false};
 };
@@ -180,4 +347,4 @@ private:
 } // namespace signals
 } // namespace nodec
 
-#endif
\ No newline at end of file
+#endif
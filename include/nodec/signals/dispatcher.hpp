@@ -0,0 +1,268 @@
+#ifndef NODEC__SIGNALS__DISPATCHER_HPP_
+#define NODEC__SIGNALS__DISPATCHER_HPP_
+
+#include "../array_view.hpp"
+#include "../asyncio/event_loop.hpp"
+#include "../type_info.hpp"
+#include "signal.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace nodec {
+namespace signals {
+
+namespace details {
+
+class BaseEventQueue {
+public:
+    virtual ~BaseEventQueue() {}
+
+    virtual void publish() = 0;
+    virtual void clear() noexcept = 0;
+    virtual std::size_t size() const noexcept = 0;
+};
+
+template<typename Event>
+class EventQueue final : public BaseEventQueue {
+public:
+    using Signal = signals::Signal<void(ArrayView<const Event>)>;
+
+    template<typename... Args>
+    void enqueue(Args &&...args) {
+        if constexpr (std::is_aggregate<Event>::value) {
+            events_.push_back(Event{std::forward<Args>(args)...});
+        } else {
+            events_.emplace_back(std::forward<Args>(args)...);
+        }
+    }
+
+    /**
+     * @brief Calls the listeners once with all the queued events.
+     *
+     * The events enqueued by the listeners are kept for the next publish.
+     * A publish called by the listeners does nothing, as the batch is in use.
+     */
+    void publish() override {
+        if (events_.empty() || publishing_) return;
+        publishing_ = true;
+
+        // The batch keeps its capacity, so a steady flow of events does not allocate.
+        batch_.swap(events_);
+        struct Clear {
+            ~Clear() {
+                queue.batch_.clear();
+                queue.publishing_ = false;
+            }
+            EventQueue &queue;
+        } clear{*this};
+
+        signal_(ArrayView<const Event>{batch_.data(), batch_.size()});
+    }
+
+    void trigger(const Event &event) {
+        signal_(ArrayView<const Event>{&event, 1});
+    }
+
+    void clear() noexcept override {
+        events_.clear();
+    }
+
+    std::size_t size() const noexcept override {
+        return events_.size();
+    }
+
+    decltype(auto) signal_interface() {
+        return signal_.signal_interface();
+    }
+
+private:
+    std::vector<Event> events_;
+    std::vector<Event> batch_;
+    bool publishing_{false};
+    Signal signal_;
+};
+
+} // namespace details
+
+/**
+ * @brief Queues the events per event type, and delivers them to the listeners in batches.
+ *
+ * Enqueuing an event only stores it in the contiguous queue of its type.
+ * update() drains each queue once, calling the listeners of the type with all
+ * the queued events at once.
+ *
+ * @code{.cpp}
+ * Dispatcher dispatcher;
+ * auto conn = dispatcher.events<Collision>().connect([](ArrayView<const Collision> collisions) {
+ *     for (auto &collision : collisions) { ... }
+ * });
+ *
+ * dispatcher.enqueue<Collision>(a, b);
+ * dispatcher.enqueue<Collision>(c, d);
+ * dispatcher.update(); // The listener is called once with two collisions.
+ * @endcode
+ *
+ * The drain can also be posted on an asyncio::EventLoop with schedule_update().
+ *
+ * The dispatcher is not thread-safe. The events must be enqueued on the thread
+ * which updates the dispatcher, or spins the event loop it is scheduled on.
+ */
+class Dispatcher {
+    template<typename Event>
+    using event_t = std::remove_cv_t<std::remove_reference_t<Event>>;
+
+    template<typename Event>
+    using EventQueue = details::EventQueue<event_t<Event>>;
+
+public:
+    Dispatcher() = default;
+
+    Dispatcher(const Dispatcher &) = delete;
+    Dispatcher &operator=(const Dispatcher &) = delete;
+
+    /**
+     * @brief Queues an event constructed from the arguments, to be delivered on the next update.
+     */
+    template<typename Event, typename... Args>
+    void enqueue(Args &&...args) {
+        queue_assured<Event>().enqueue(std::forward<Args>(args)...);
+    }
+
+    template<typename Event>
+    void enqueue(Event &&event) {
+        queue_assured<Event>().enqueue(std::forward<Event>(event));
+    }
+
+    /**
+     * @brief Delivers an event to the listeners at once, as a batch of one, bypassing the queue.
+     */
+    template<typename Event>
+    void trigger(const Event &event) {
+        queue_assured<Event>().trigger(event);
+    }
+
+    /**
+     * @brief Returns the signal interface emitted with each batch of the events of the type.
+     *
+     * The listener signature is void(ArrayView<const Event>). The events are
+     * valid only while the listener runs.
+     */
+    template<typename Event>
+    decltype(auto) events() {
+        return queue_assured<Event>().signal_interface();
+    }
+
+    /**
+     * @brief Delivers the queued events of all the types.
+     *
+     * Each queue is drained once. The events enqueued by the listeners are
+     * delivered on the next update.
+     */
+    void update() {
+        // The queues added by the listeners are updated too. The indices stay valid.
+        for (std::size_t i = 0; i < queues_.size(); ++i) {
+            if (queues_[i]) queues_[i]->publish();
+        }
+    }
+
+    /**
+     * @brief Delivers the queued events of one type.
+     */
+    template<typename Event>
+    void update() {
+        if (auto *queue = queue_if_exists<Event>()) queue->publish();
+    }
+
+    /**
+     * @brief Posts an update on the event loop.
+     *
+     * While an update is posted and not yet run, the next calls post nothing,
+     * so it can be called on every enqueue.
+     * The dispatcher must outlive the posted update.
+     */
+    void schedule_update(asyncio::EventLoop &event_loop) {
+        if (update_scheduled_) return;
+        update_scheduled_ = true;
+
+        event_loop.schedule([this]() {
+            update_scheduled_ = false;
+            update();
+        });
+    }
+
+    bool update_scheduled() const noexcept {
+        return update_scheduled_;
+    }
+
+    /**
+     * @brief Returns the number of the queued events of the type.
+     */
+    template<typename Event>
+    std::size_t size() const noexcept {
+        const auto *queue = queue_if_exists<Event>();
+        return queue ? queue->size() : 0u;
+    }
+
+    /**
+     * @brief Returns the number of the queued events of all the types.
+     */
+    std::size_t size() const noexcept {
+        std::size_t count = 0;
+        for (const auto &queue : queues_) {
+            if (queue) count += queue->size();
+        }
+        return count;
+    }
+
+    /**
+     * @brief Discards the queued events of the type, without delivering them.
+     */
+    template<typename Event>
+    void clear() noexcept {
+        if (auto *queue = queue_if_exists<Event>()) queue->clear();
+    }
+
+    /**
+     * @brief Discards the queued events of all the types, without delivering them.
+     */
+    void clear() noexcept {
+        for (auto &queue : queues_) {
+            if (queue) queue->clear();
+        }
+    }
+
+private:
+    template<typename Event>
+    EventQueue<Event> &queue_assured() {
+        const auto index = type_seq_index<event_t<Event>>::value();
+
+        if (!(index < queues_.size())) {
+            queues_.resize(index + 1u);
+        }
+
+        auto &queue = queues_[index];
+        if (!queue) {
+            queue.reset(new EventQueue<Event>());
+        }
+        return static_cast<EventQueue<Event> &>(*queue);
+    }
+
+    template<typename Event>
+    EventQueue<Event> *queue_if_exists() const noexcept {
+        const auto index = type_seq_index<event_t<Event>>::value();
+        if (!(index < queues_.size())) return nullptr;
+        return static_cast<EventQueue<Event> *>(queues_[index].get());
+    }
+
+    std::vector<std::unique_ptr<details::BaseEventQueue>> queues_;
+    bool update_scheduled_{false};
+};
+
+} // namespace signals
+} // namespace nodec
+
+#endif
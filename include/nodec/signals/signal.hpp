@@ -117,6 +117,24 @@ public:
         return {connection};
     }
 
+    /**
+     * @brief Connects a free function known at compile time.
+     */
+    template<auto Candidate>
+    RawConnection connect() {
+        return connect(SignalImpl::Callback::template bind<Candidate>());
+    }
+
+    /**
+     * @brief Connects a member function known at compile time, bound to the instance.
+     *
+     * The instance must outlive the connection.
+     */
+    template<auto Candidate, typename Type>
+    RawConnection connect(Type &instance) {
+        return connect(SignalImpl::Callback::template bind<Candidate>(&instance));
+    }
+
 private:
     SignalImpl &impl_;
 };
@@ -127,7 +145,7 @@ class Signal;
 template<typename... Args>
 class Signal<void(Args...)> final {
 public:
-    using SignalInterface = SignalInterface<void(Args...)>;
+    using SignalInterface = signals::SignalInterface<void(Args...)>;
 
     Signal() {}
     ~Signal() {}
@@ -145,6 +163,13 @@ public:
         return {impl_};
     }
 
+    /**
+     * @brief Checks if the signal has no connection.
+     */
+    bool empty() const noexcept {
+        return impl_.empty();
+    }
+
     void operator()(Args... args) {
         impl_.operator()(std::forward<Args>(args)...);
     }
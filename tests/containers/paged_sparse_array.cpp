@@ -0,0 +1,96 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include <nodec/containers/paged_sparse_array.hpp>
+
+#include <array>
+#include <cstdint>
+
+TEST_CASE("Testing operator[] and try_get.") {
+    using namespace nodec::containers;
+
+    PagedSparseArray<std::size_t> sparse;
+
+    std::array<std::pair<std::size_t, std::size_t>, 6> expected{
+        {{0, 0},
+         {1, 1},
+         {9, 2},
+         {DEFAULT_SPARSE_PAGE_SIZE, 3},
+         {0x0FFFFF, 4},
+         {0x1FFFFF, 5}}};
+
+    for (const auto &pair : expected) {
+        sparse[pair.first] = pair.second;
+    }
+
+    for (const auto &pair : expected) {
+        INFO(pair.first);
+        auto *value = sparse.try_get(pair.first);
+        REQUIRE(value != nullptr);
+        CHECK(*value == pair.second);
+    }
+
+    CHECK(sparse.try_get(2) == nullptr);
+    CHECK(sparse.try_get(DEFAULT_SPARSE_PAGE_SIZE * 2) == nullptr);
+    CHECK(sparse.try_get(0x2FFFFF) == nullptr);
+
+    // Pages without any element share the null page.
+    CHECK(sparse.page_count() == 4);
+}
+
+TEST_CASE("Testing erase and contains.") {
+    using namespace nodec::containers;
+
+    BasicPagedSparseArray<std::uint32_t, 64> sparse;
+
+    sparse[10] = 100;
+    CHECK(sparse.contains(10));
+    CHECK(!sparse.contains(11));
+
+    CHECK(sparse.erase(10));
+    CHECK(!sparse.erase(10));
+    CHECK(!sparse.contains(10));
+    CHECK(!sparse.erase(1000));
+
+    CHECK(sparse[10] == 0);
+    CHECK(sparse.contains(10));
+}
+
+TEST_CASE("Testing reserve and move.") {
+    using namespace nodec::containers;
+
+    BasicPagedSparseArray<std::uint32_t, 64> sparse;
+    sparse.reserve(130);
+    CHECK(sparse.page_count() == 3);
+    CHECK(!sparse.contains(129));
+
+    sparse[129] = 1;
+
+    auto other = std::move(sparse);
+    CHECK(other.contains(129));
+    CHECK(other.page_count() == 3);
+    CHECK(sparse.page_count() == 0);
+    CHECK(!sparse.contains(129));
+}
+
+TEST_CASE("Testing shrink_to_fit.") {
+    using namespace nodec::containers;
+
+    BasicPagedSparseArray<std::uint32_t, 64> sparse;
+    sparse[10] = 1;
+    sparse[100] = 2;
+    sparse[300] = 3;
+    CHECK(sparse.page_count() == 3);
+    CHECK(sparse.capacity() == 192);
+
+    sparse.erase(100);
+    sparse.erase(300);
+    sparse.shrink_to_fit();
+    CHECK(sparse.page_count() == 1);
+    CHECK(sparse.capacity() == 64);
+    CHECK(*sparse.try_get(10) == 1);
+    CHECK(!sparse.contains(300));
+
+    sparse[300] = 4;
+    CHECK(*sparse.try_get(300) == 4);
+}
@@ -0,0 +1,114 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include <nodec/containers/paged_vector.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+TEST_CASE("Testing push_back and element addresses.") {
+    using namespace nodec::containers;
+
+    BasicPagedVector<std::string, 4> values;
+
+    values.push_back("0");
+    auto *first = &values[0];
+
+    for (int i = 1; i < 100; ++i) {
+        values.emplace_back(std::to_string(i));
+    }
+
+    // Growing never relocates the elements.
+    CHECK(first == &values[0]);
+    CHECK(*first == "0");
+
+    CHECK(values.size() == 100);
+    CHECK(values.page_count() == 25);
+    for (int i = 0; i < 100; ++i) {
+        CHECK(values[i] == std::to_string(i));
+    }
+    CHECK(values.back() == "99");
+
+    values.pop_back();
+    CHECK(values.size() == 99);
+    CHECK(values.back() == "98");
+}
+
+TEST_CASE("Testing reserve and clear.") {
+    using namespace nodec::containers;
+
+    BasicPagedVector<int, 8> values;
+
+    values.reserve(17);
+    CHECK(values.page_count() == 3);
+    CHECK(values.capacity() == 24);
+    CHECK(values.empty());
+
+    for (int i = 0; i < 20; ++i) values.push_back(i);
+    values.clear();
+    CHECK(values.empty());
+    CHECK(values.page_count() == 3);
+}
+
+TEST_CASE("Testing element lifetimes.") {
+    using namespace nodec::containers;
+
+    auto counter = std::make_shared<int>(0);
+
+    {
+        BasicPagedVector<std::shared_ptr<int>, 2> values;
+        for (int i = 0; i < 5; ++i) values.push_back(counter);
+        CHECK(counter.use_count() == 6);
+
+        values.pop_back();
+        CHECK(counter.use_count() == 5);
+
+        BasicPagedVector<std::shared_ptr<int>, 2> moved{std::move(values)};
+        CHECK(moved.size() == 4);
+        CHECK(values.size() == 0);
+        CHECK(counter.use_count() == 5);
+    }
+
+    CHECK(counter.use_count() == 1);
+}
+
+TEST_CASE("Testing shrink_to_fit.") {
+    using namespace nodec::containers;
+
+    BasicPagedVector<int, 4> values;
+    for (int i = 0; i < 10; ++i) values.push_back(i);
+    CHECK(values.page_count() == 3);
+
+    while (values.size() > 5) values.pop_back();
+    CHECK(values.page_count() == 3);
+
+    values.shrink_to_fit();
+    CHECK(values.page_count() == 2);
+    CHECK(values.back() == 4);
+
+    values.clear();
+    values.shrink_to_fit();
+    CHECK(values.page_count() == 0);
+}
+
+TEST_CASE("Testing assign.") {
+    using namespace nodec::containers;
+
+    BasicPagedVector<int, 8> values;
+    for (int i = 0; i < 5; ++i) values.push_back(-i);
+
+    std::vector<int> source(20);
+    for (int i = 0; i < 20; ++i) source[i] = i;
+
+    values.assign(source.begin(), source.end());
+    CHECK(values.size() == 20);
+    CHECK(values.page_count() == 3);
+    for (int i = 0; i < 20; ++i) {
+        CHECK(values[i] == i);
+    }
+
+    values.assign(source.begin(), source.begin() + 3);
+    CHECK(values.size() == 3);
+    CHECK(values.back() == 2);
+}
@@ -4,6 +4,7 @@
 #include <nodec/containers/sparse_table.hpp>
 
 #include <array>
+#include <string>
 
 TEST_CASE("Testing emplace.") {
     using namespace nodec::containers;
@@ -50,4 +51,76 @@ TEST_CASE("Testing emplace.") {
     // MESSAGE(sizeof(int *));
     // MESSAGE(sizeof(std::vector<int>));
     // MESSAGE(sizeof(std::unique_ptr<int>));
-}
\ No newline at end of file
+}
+TEST_CASE("Testing erase.") {
+    using namespace nodec::containers;
+
+    SparseTable<std::string> sparse;
+
+    for (int i = 0; i < 200; ++i) {
+        sparse[i] = std::to_string(i);
+    }
+
+    for (int i = 0; i < 200; i += 2) {
+        CHECK(sparse.erase(i));
+    }
+    CHECK(!sparse.erase(0));
+    CHECK(!sparse.erase(1000));
+
+    for (int i = 0; i < 200; ++i) {
+        INFO(i);
+        auto *value = sparse.try_get(i);
+        if (i % 2 == 0) {
+            CHECK(value == nullptr);
+            CHECK(!sparse.contains(i));
+        } else {
+            REQUIRE(value != nullptr);
+            CHECK(*value == std::to_string(i));
+        }
+    }
+
+    for (int i = 1; i < 200; i += 2) {
+        CHECK(sparse.erase(i));
+    }
+    CHECK(sparse.bucket_count() == 0);
+}
+
+TEST_CASE("Testing groups larger than a bitmap word.") {
+    using namespace nodec::containers;
+
+    BasicSparseTable<int, 200> sparse;
+
+    for (int i = 199; i >= 0; i -= 3) {
+        sparse[i] = i;
+    }
+
+    for (int i = 0; i < 200; ++i) {
+        INFO(i);
+        CHECK(sparse.contains(i) == ((199 - i) % 3 == 0));
+        if (sparse.contains(i)) CHECK(*sparse.try_get(i) == i);
+    }
+}
+
+TEST_CASE("Testing shrink_to_fit.") {
+    using namespace nodec::containers;
+
+    BasicSparseTable<int, 64> sparse;
+    for (int i = 0; i < 256; ++i) {
+        sparse[i] = i;
+    }
+    const auto full_bytes = sparse.memory_usage();
+
+    for (int i = 0; i < 256; ++i) {
+        if (i != 3 && i != 70) sparse.erase(i);
+    }
+    sparse.shrink_to_fit();
+
+    CHECK(sparse.capacity() == 2);
+    CHECK(sparse.memory_usage() < full_bytes);
+    CHECK(*sparse.try_get(3) == 3);
+    CHECK(*sparse.try_get(70) == 70);
+    CHECK(!sparse.contains(200));
+
+    sparse[200] = 200;
+    CHECK(*sparse.try_get(200) == 200);
+}
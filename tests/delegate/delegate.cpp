@@ -0,0 +1,130 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include <nodec/delegate.hpp>
+
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace {
+
+int twice(int value) {
+    return value * 2;
+}
+
+struct Counter {
+    int add(int value) {
+        count += value;
+        return count;
+    }
+
+    int count{0};
+};
+
+} // namespace
+
+TEST_CASE("Testing the empty delegate.") {
+    using namespace nodec;
+
+    Delegate<void(int)> delegate;
+    CHECK(!delegate);
+    CHECK(delegate == nullptr);
+
+    Delegate<int(int)> null_function{static_cast<int (*)(int)>(nullptr)};
+    CHECK(!null_function);
+
+    int (*null_pointer)(int) = nullptr;
+    Delegate<int(int)> null_lvalue{null_pointer};
+    CHECK(!null_lvalue);
+}
+
+TEST_CASE("Testing the inline callables.") {
+    using namespace nodec;
+
+    SUBCASE("function pointer") {
+        Delegate<int(int)> delegate{&twice};
+        CHECK(delegate);
+        CHECK(!delegate.allocated());
+        CHECK(delegate(21) == 42);
+    }
+
+    SUBCASE("function reference") {
+        Delegate<int(int)> delegate{twice};
+        CHECK(delegate);
+        CHECK(delegate(21) == 42);
+    }
+
+    SUBCASE("lambda capturing references") {
+        int a = 1, b = 2;
+        Delegate<int(int)> delegate{[&](int value) { return a + b + value; }};
+        CHECK(!delegate.allocated());
+        CHECK(delegate(3) == 6);
+
+        a = 10;
+        CHECK(delegate(3) == 15);
+    }
+
+    SUBCASE("bound free function") {
+        auto delegate = Delegate<int(int)>::bind<&twice>();
+        CHECK(!delegate.allocated());
+        CHECK(delegate(4) == 8);
+    }
+
+    SUBCASE("bound member function") {
+        Counter counter;
+        auto delegate = Delegate<int(int)>::bind<&Counter::add>(counter);
+        CHECK(!delegate.allocated());
+        CHECK(delegate(2) == 2);
+        CHECK(delegate(3) == 5);
+        CHECK(counter.count == 5);
+    }
+}
+
+TEST_CASE("Testing the heap callables.") {
+    using namespace nodec;
+
+    auto shared = std::make_shared<int>(7);
+    Delegate<int()> delegate{[shared]() { return *shared; }};
+    CHECK(delegate.allocated());
+    CHECK(shared.use_count() == 2);
+
+    Delegate<int()> copy = delegate;
+    CHECK(shared.use_count() == 3);
+    CHECK(copy() == 7);
+
+    Delegate<int()> moved = std::move(copy);
+    CHECK(!copy);
+    CHECK(shared.use_count() == 3);
+    CHECK(moved() == 7);
+
+    moved = nullptr;
+    CHECK(shared.use_count() == 2);
+
+    delegate = Delegate<int()>{[]() { return 1; }};
+    CHECK(shared.use_count() == 1);
+    CHECK(delegate() == 1);
+
+    std::function<std::string(const std::string &)> function = [](const std::string &str) { return str + "!"; };
+    Delegate<std::string(const std::string &)> wrapped{function};
+    CHECK(wrapped("hello") == "hello!");
+}
+
+TEST_CASE("Testing the copy and the move of inline callables.") {
+    using namespace nodec;
+
+    int count = 0;
+    Delegate<void()> delegate{[&]() { ++count; }};
+
+    Delegate<void()> copy;
+    copy = delegate;
+    copy();
+    delegate();
+    CHECK(count == 2);
+
+    Delegate<void()> moved;
+    moved = std::move(delegate);
+    CHECK(!delegate);
+    moved();
+    CHECK(count == 3);
+}
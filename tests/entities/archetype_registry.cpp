@@ -0,0 +1,223 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include <nodec/entities/archetype_registry.hpp>
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+struct Position {
+    float x, y;
+};
+
+struct Velocity {
+    float x, y;
+};
+
+struct Name {
+    std::string value;
+};
+
+struct Tag {};
+
+} // namespace
+
+TEST_CASE("Testing create_entity and destroy_entity.") {
+    using namespace nodec::entities;
+
+    ArchetypeRegistry registry;
+
+    auto e0 = registry.create_entity();
+    auto e1 = registry.create_entity();
+    CHECK(registry.is_valid(e0));
+    CHECK(registry.is_valid(e1));
+
+    registry.destroy_entity(e0);
+    CHECK(!registry.is_valid(e0));
+    CHECK(registry.is_valid(e1));
+    CHECK_THROWS(registry.destroy_entity(e0));
+
+    // The number is recycled with a new version.
+    auto e2 = registry.create_entity();
+    CHECK(to_entity(e2) == to_entity(e0));
+    CHECK(to_version(e2) != to_version(e0));
+    CHECK(registry.is_valid(e2));
+    CHECK(!registry.is_valid(e0));
+}
+
+TEST_CASE("Testing emplace_component and remove_component.") {
+    using namespace nodec::entities;
+
+    ArchetypeRegistry registry;
+    auto e0 = registry.create_entity();
+
+    auto result = registry.emplace_component<Position>(e0, 1.f, 2.f);
+    CHECK(result.second);
+    CHECK(result.first.x == 1.f);
+
+    result = registry.emplace_component<Position>(e0, 3.f, 4.f);
+    CHECK(!result.second);
+    CHECK(result.first.x == 1.f);
+
+    registry.emplace_component<Name>(e0, "e0");
+    registry.emplace_component<Tag>(e0);
+    CHECK(registry.all_of<Position, Name, Tag>(e0));
+    CHECK(!registry.any_of<Velocity>(e0));
+
+    // The other components survive the transitions.
+    CHECK(registry.remove_component<Tag>(e0));
+    CHECK(!registry.remove_component<Tag>(e0));
+    CHECK(registry.get_component<Position>(e0).y == 2.f);
+    CHECK(registry.get_component<Name>(e0).value == "e0");
+
+    CHECK(registry.try_get_component<Velocity>(e0) == nullptr);
+    CHECK_THROWS(registry.get_component<Velocity>(e0));
+
+    registry.destroy_entity(e0);
+    CHECK_THROWS(registry.get_component<Position>(e0));
+    CHECK(registry.try_get_component<Position>(e0) == nullptr);
+}
+
+TEST_CASE("Testing the rows are kept dense.") {
+    using namespace nodec::entities;
+
+    ArchetypeRegistry registry;
+
+    std::vector<Entity> entities;
+    for (int i = 0; i < 5000; ++i) {
+        auto entity = registry.create_entity();
+        registry.emplace_component<Name>(entity, std::to_string(i));
+        registry.emplace_component<Position>(entity, static_cast<float>(i), 0.f);
+        entities.push_back(entity);
+    }
+
+    for (int i = 0; i < 5000; i += 2) {
+        registry.destroy_entity(entities[i]);
+    }
+    for (int i = 1; i < 5000; i += 4) {
+        registry.remove_component<Position>(entities[i]);
+    }
+
+    for (int i = 1; i < 5000; i += 2) {
+        CHECK(registry.get_component<Name>(entities[i]).value == std::to_string(i));
+        CHECK(registry.all_of<Position>(entities[i]) == (i % 4 == 3));
+        if (i % 4 == 3) {
+            CHECK(registry.get_component<Position>(entities[i]).x == static_cast<float>(i));
+        }
+    }
+}
+
+TEST_CASE("Testing view.") {
+    using namespace nodec::entities;
+
+    ArchetypeRegistry registry;
+
+    auto e0 = registry.create_entity();
+    auto e1 = registry.create_entity();
+    auto e2 = registry.create_entity();
+    registry.emplace_component<Position>(e0, 0.f, 0.f);
+    registry.emplace_component<Position>(e1, 1.f, 0.f);
+    registry.emplace_component<Velocity>(e1, 1.f, 1.f);
+    registry.emplace_component<Position>(e2, 2.f, 0.f);
+    registry.emplace_component<Velocity>(e2, 2.f, 2.f);
+    registry.emplace_component<Tag>(e2);
+
+    CHECK(registry.view<Position>().size() == 3);
+    CHECK(registry.view<Position, Velocity>().size() == 2);
+
+    std::vector<Entity> visited;
+    registry.view<Position, Velocity>().each([&](auto entity, Position &position, Velocity &velocity) {
+        position.x += velocity.x;
+        visited.push_back(entity);
+    });
+    CHECK(visited.size() == 2);
+    CHECK(registry.get_component<Position>(e0).x == 0.f);
+    CHECK(registry.get_component<Position>(e1).x == 2.f);
+    CHECK(registry.get_component<Position>(e2).x == 4.f);
+
+    const auto &const_registry = registry;
+    int count = 0;
+    const_registry.view<Position, Tag>().each([&](auto entity, const Position &, const Tag &) {
+        CHECK(entity == e2);
+        ++count;
+    });
+    CHECK(count == 1);
+}
+
+TEST_CASE("Testing the components are destroyed.") {
+    using namespace nodec::entities;
+
+    auto counter = std::make_shared<int>(0);
+    {
+        ArchetypeRegistry registry;
+        for (int i = 0; i < 100; ++i) {
+            auto entity = registry.create_entity();
+            registry.emplace_component<std::shared_ptr<int>>(entity, counter);
+            registry.emplace_component<Position>(entity);
+        }
+        CHECK(counter.use_count() == 101);
+    }
+    CHECK(counter.use_count() == 1);
+}
+
+TEST_CASE("Testing remove_all_components, visit and each_entity.") {
+    using namespace nodec;
+    using namespace nodec::entities;
+
+    ArchetypeRegistry registry;
+    auto e0 = registry.create_entity();
+    auto e1 = registry.create_entity();
+    auto e2 = registry.create_entity();
+    registry.emplace_component<Position>(e0, 1.f, 2.f);
+    registry.emplace_component<Name>(e0, "e0");
+    registry.emplace_component<Position>(e1, 3.f, 4.f);
+    registry.destroy_entity(e2);
+
+    std::vector<type_seq_index_type> visited;
+    registry.visit(e0, [&](const type_info &type, void *component) {
+        visited.push_back(type.seq_index());
+        if (type == type_id<Name>()) CHECK(static_cast<Name *>(component)->value == "e0");
+    });
+    CHECK(visited.size() == 2);
+
+    std::vector<Entity> entities;
+    registry.each_entity([&](auto entity) { entities.push_back(entity); });
+    CHECK(entities == std::vector<Entity>{e1, e0});
+
+    registry.remove_all_components(e0);
+    CHECK(registry.is_valid(e0));
+    CHECK(!registry.any_of<Position, Name>(e0));
+    CHECK(registry.get_component<Position>(e1).x == 3.f);
+    CHECK(registry.view<Position>().size() == 1);
+}
+
+TEST_CASE("Testing move of the registry.") {
+    using namespace nodec::entities;
+
+    ArchetypeRegistry source;
+    auto e0 = source.create_entity();
+    source.emplace_component<Position>(e0, 1.f, 2.f);
+
+    ArchetypeRegistry moved = std::move(source);
+    CHECK(moved.get_component<Position>(e0).y == 2.f);
+
+    ArchetypeRegistry assigned;
+    assigned.create_entity();
+    assigned = std::move(moved);
+    CHECK(assigned.get_component<Position>(e0).x == 1.f);
+
+    auto e1 = assigned.create_entity();
+    assigned.emplace_component<Position>(e1, 3.f, 4.f);
+    CHECK(assigned.view<Position>().size() == 2);
+}
+
+TEST_CASE("Testing registry_for_t.") {
+    using namespace nodec::entities;
+
+    static_assert(std::is_same<registry_for_t<Entity, SparseSetBackend>, Registry>::value, "");
+    static_assert(std::is_same<registry_for_t<Entity, ArchetypeBackend>, ArchetypeRegistry>::value, "");
+}
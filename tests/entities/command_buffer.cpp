@@ -0,0 +1,125 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include <nodec/concurrent/thread_pool_executor.hpp>
+#include <nodec/entities/command_buffer.hpp>
+#include <nodec/entities/registry.hpp>
+
+#include <string>
+#include <vector>
+
+template<typename Component>
+int count_of(nodec::entities::Registry &registry) {
+    int count = 0;
+    registry.view<Component>().each([&](auto, auto &) { ++count; });
+    return count;
+}
+
+TEST_CASE("Testing CommandBuffer.") {
+    using namespace nodec::entities;
+
+    Registry registry;
+    CommandBuffer commands;
+
+    const auto existing = registry.create_entity();
+    registry.emplace_component<int>(existing, 1);
+
+    SUBCASE("placeholders are resolved on playback") {
+        const auto a = commands.create_entity();
+        const auto b = commands.create_entity();
+        CHECK(CommandBuffer::is_placeholder(a));
+        CHECK(!CommandBuffer::is_placeholder(existing));
+        CHECK(!CommandBuffer::is_placeholder(null_entity));
+        CHECK(!registry.is_valid(a));
+
+        commands.emplace_component<int>(a, 10);
+        commands.emplace_component<std::string>(b, "b");
+        commands.emplace_component<int>(b, 20);
+        commands.remove_component<int>(a);
+
+        // Nothing is applied until playback.
+        CHECK(count_of<int>(registry) == 1);
+
+        commands.playback(registry);
+        CHECK(commands.empty());
+
+        int count = 0;
+        registry.view<int>().each([&](auto entity, int &value) {
+            ++count;
+            CHECK(value == (entity == existing ? 1 : 20));
+        });
+        CHECK(count == 2);
+        CHECK(count_of<std::string>(registry) == 1);
+    }
+
+    SUBCASE("emplace replaces the existing component") {
+        commands.emplace_component<int>(existing, 5);
+        commands.playback(registry);
+        CHECK(registry.get_component<int>(existing) == 5);
+    }
+
+    SUBCASE("commands for invalid entities are skipped") {
+        commands.destroy_entity(existing);
+        commands.destroy_entity(existing);
+        commands.emplace_component<int>(existing, 3);
+
+        const auto created = commands.create_entity();
+        commands.emplace_component<int>(created, 4);
+
+        commands.playback(registry);
+        CHECK(!registry.is_valid(existing));
+
+        int count = 0;
+        registry.view<int>().each([&](auto, int &value) {
+            ++count;
+            CHECK(value == 4);
+        });
+        CHECK(count == 1);
+    }
+
+    SUBCASE("the buffer is reusable") {
+        commands.emplace_component<int>(commands.create_entity(), 1);
+        commands.playback(registry);
+        commands.emplace_component<int>(commands.create_entity(), 2);
+        commands.playback(registry);
+
+        CHECK(count_of<int>(registry) == 3);
+    }
+}
+
+TEST_CASE("Testing CommandBuffers from worker threads.") {
+    using namespace nodec::entities;
+
+    Registry registry;
+    nodec::concurrent::ThreadPoolExecutor executor{4};
+    CommandBuffers commands{8};
+
+    std::vector<Entity> entities(1000);
+    for (auto &entity : entities) {
+        entity = registry.create_entity();
+        registry.emplace_component<int>(entity, static_cast<int>(to_entity(entity)));
+    }
+
+    registry.view<int>().each_parallel(
+        executor, [&](auto entity, int &value) {
+            auto &local = commands.local();
+            if (value % 2 == 0) {
+                local.destroy_entity(entity);
+            } else {
+                local.emplace_component<double>(local.create_entity(), static_cast<double>(value));
+            }
+        },
+        50);
+
+    // Nothing is applied until playback.
+    CHECK(count_of<int>(registry) == 1000);
+    CHECK(count_of<double>(registry) == 0);
+
+    commands.playback(registry);
+
+    CHECK(count_of<int>(registry) == 500);
+    CHECK(count_of<double>(registry) == 500);
+    for (const auto entity : entities) {
+        CHECK(registry.is_valid(entity) == (to_entity(entity) % 2 == 1));
+    }
+}
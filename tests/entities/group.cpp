@@ -0,0 +1,115 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include <nodec/entities/registry.hpp>
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+namespace {
+
+template<typename Group, typename... Components>
+void check_group_layout(nodec::entities::Registry &registry, const Group &group) {
+    // The group range must be the same in every owned storage.
+    std::vector<nodec::entities::Entity> members;
+    for (const auto entity : group) {
+        members.push_back(entity);
+    }
+    CHECK(members.size() == group.size());
+
+    for (const auto entity : members) {
+        CHECK(registry.all_of<Components...>(entity));
+        CHECK(group.contains(entity));
+    }
+}
+
+} // namespace
+
+TEST_CASE("Testing group.") {
+    using namespace nodec::entities;
+
+    Registry registry;
+
+    std::vector<Entity> entities(100);
+    for (auto &entity : entities) {
+        entity = registry.create_entity();
+    }
+
+    // Some entities already exist before the group is created.
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+        registry.emplace_component<int>(entities[i], static_cast<int>(i));
+        if (i % 3 == 0) registry.emplace_component<double>(entities[i], static_cast<double>(i));
+    }
+
+    auto group = registry.group<int, double>();
+    CHECK(group.size() == 34);
+    check_group_layout<decltype(group), int, double>(registry, group);
+
+    SUBCASE("emplace and remove keep the membership") {
+        for (std::size_t i = 0; i < entities.size(); ++i) {
+            if (i % 3 == 1) registry.emplace_component<double>(entities[i], static_cast<double>(i));
+        }
+        CHECK(group.size() == 67);
+        check_group_layout<decltype(group), int, double>(registry, group);
+
+        for (std::size_t i = 0; i < entities.size(); i += 2) {
+            registry.remove_component<int>(entities[i]);
+        }
+        for (std::size_t i = 1; i < entities.size(); i += 4) {
+            registry.destroy_entity(entities[i]);
+        }
+
+        std::size_t expected = 0;
+        for (std::size_t i = 0; i < entities.size(); ++i) {
+            if (i % 2 == 0 || i % 4 == 1) continue;
+            if (i % 3 == 0 || i % 3 == 1) ++expected;
+        }
+        CHECK(group.size() == expected);
+        check_group_layout<decltype(group), int, double>(registry, group);
+
+        std::size_t count = 0;
+        group.each([&](Entity entity, int &i, double &d) {
+            CHECK(registry.get_component<int>(entity) == i);
+            CHECK(static_cast<double>(i) == d);
+            ++count;
+        });
+        CHECK(count == expected);
+    }
+
+    SUBCASE("each walks the parallel arrays") {
+        std::set<Entity> visited;
+        group.each([&](Entity entity, int &i, double &d) {
+            CHECK(registry.get_component<int>(entity) == i);
+            CHECK(static_cast<double>(i) == d);
+            visited.insert(entity);
+        });
+        CHECK(visited.size() == group.size());
+    }
+
+    SUBCASE("remove the current entity during each") {
+        group.each([&](Entity entity, int &, double &) {
+            registry.remove_component<double>(entity);
+        });
+        CHECK(group.size() == 0);
+        CHECK(registry.view<double>().begin() == registry.view<double>().end());
+    }
+
+    SUBCASE("get components") {
+        const auto entity = *group.begin();
+        auto components = group.get(entity);
+        CHECK(&std::get<0>(components) == &registry.get_component<int>(entity));
+        CHECK(&group.get<double>(entity) == &registry.get_component<double>(entity));
+    }
+
+    SUBCASE("the same group is returned") {
+        auto other = registry.group<int, double>();
+        CHECK(other.size() == group.size());
+        registry.emplace_component<double>(entities[1]);
+        CHECK(other.size() == group.size());
+    }
+
+    SUBCASE("a storage can be owned by only one group") {
+        CHECK_THROWS(registry.group<double, char>());
+    }
+}
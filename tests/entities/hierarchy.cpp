@@ -0,0 +1,190 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include <nodec/entities/hierarchy.hpp>
+#include <nodec/entities/registry.hpp>
+#include <nodec/gfx/gfx.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("Testing the breadth-first order.") {
+    using namespace nodec::entities;
+
+    Registry registry;
+    Hierarchy hierarchy;
+
+    const auto root = registry.create_entity();
+    const auto a = registry.create_entity();
+    const auto b = registry.create_entity();
+    const auto a1 = registry.create_entity();
+    const auto b1 = registry.create_entity();
+
+    // Attach the deeper ones first, so the order differs from the attach order.
+    hierarchy.set_parent(a1, a);
+    hierarchy.set_parent(b1, b);
+    hierarchy.set_parent(a, root);
+    hierarchy.set_parent(b, root);
+
+    CHECK(hierarchy.size() == 5);
+    CHECK(hierarchy.parent(a1) == a);
+    CHECK((hierarchy.parent(root) == null_entity));
+    CHECK(hierarchy.depth(root) == 0);
+    CHECK(hierarchy.depth(b1) == 2);
+
+    const auto order = hierarchy.order();
+    const auto parents = hierarchy.parent_positions();
+    REQUIRE(order.size() == 5);
+    CHECK(order[0] == root);
+    CHECK(order[1] == a);
+    CHECK(order[2] == b);
+    CHECK(order[3] == a1);
+    CHECK(order[4] == b1);
+
+    for (std::size_t pos = 0; pos < order.size(); ++pos) {
+        CHECK(hierarchy.position(order[pos]) == pos);
+        if (parents[pos] == Hierarchy::npos) {
+            CHECK((hierarchy.parent(order[pos]) == null_entity));
+        } else {
+            CHECK(parents[pos] < pos);
+            CHECK(order[parents[pos]] == hierarchy.parent(order[pos]));
+        }
+    }
+
+    std::vector<Entity> children;
+    hierarchy.each_child(root, [&](auto child) { children.push_back(child); });
+    CHECK(children == std::vector<Entity>{a, b});
+
+    CHECK_THROWS_AS(hierarchy.set_parent(root, b1), std::invalid_argument);
+    CHECK_THROWS_AS(hierarchy.set_parent(a, a), std::invalid_argument);
+}
+
+TEST_CASE("Testing the removal.") {
+    using namespace nodec::entities;
+
+    Registry registry;
+    Hierarchy hierarchy;
+
+    const auto root = registry.create_entity();
+    const auto a = registry.create_entity();
+    const auto a1 = registry.create_entity();
+    const auto a2 = registry.create_entity();
+
+    hierarchy.set_parent(a, root);
+    hierarchy.set_parent(a1, a);
+    hierarchy.set_parent(a2, a);
+
+    SUBCASE("The children of a removed entity become roots.") {
+        CHECK(hierarchy.remove(a));
+        CHECK(!hierarchy.contains(a));
+        CHECK((hierarchy.parent(a1) == null_entity));
+        CHECK(hierarchy.depth(a2) == 0);
+        CHECK(hierarchy.order().size() == 3);
+
+        std::vector<Entity> children;
+        hierarchy.each_child(root, [&](auto child) { children.push_back(child); });
+        CHECK(children.empty());
+    }
+
+    SUBCASE("The subtree is removed with its descendants.") {
+        CHECK(hierarchy.remove_subtree(a) == 3);
+        CHECK(hierarchy.size() == 1);
+        CHECK(hierarchy.contains(root));
+        CHECK(!hierarchy.contains(a2));
+    }
+
+    SUBCASE("The reparented entity moves with its subtree.") {
+        hierarchy.set_parent(a, null_entity);
+        hierarchy.set_parent(root, a1);
+        CHECK(hierarchy.depth(root) == 2);
+        CHECK(hierarchy.order()[0] == a);
+    }
+
+    SUBCASE("A newer version replaces the older one.") {
+        registry.destroy_entity(a2);
+        const auto reused = registry.create_entity();
+        REQUIRE(to_entity(reused) == to_entity(a2));
+
+        hierarchy.set_parent(reused, root);
+        CHECK(!hierarchy.contains(a2));
+        CHECK(hierarchy.parent(reused) == root);
+        CHECK(hierarchy.size() == 4);
+    }
+
+    SUBCASE("An older version does not evict the newer one.") {
+        registry.destroy_entity(a2);
+        const auto reused = registry.create_entity();
+        REQUIRE(to_entity(reused) == to_entity(a2));
+        hierarchy.set_parent(reused, root);
+
+        CHECK_THROWS_AS(hierarchy.emplace(a2), std::invalid_argument);
+        CHECK_THROWS_AS(hierarchy.set_parent(a2, root), std::invalid_argument);
+        CHECK_THROWS_AS(hierarchy.set_parent(a1, a2), std::invalid_argument);
+        CHECK(hierarchy.contains(reused));
+        CHECK(hierarchy.parent(reused) == root);
+        CHECK(hierarchy.size() == 4);
+    }
+}
+
+TEST_CASE("Testing the incremental transform propagation.") {
+    using namespace nodec;
+    using namespace nodec::entities;
+
+    struct Local {
+        Vector3f position;
+    };
+
+    Registry registry;
+    Hierarchy hierarchy;
+
+    // Two chains of three.
+    std::vector<Entity> entities;
+    for (int i = 0; i < 6; ++i) {
+        const auto entity = registry.create_entity();
+        registry.emplace_component<Local>(entity, Local{Vector3f(1.f, 0.f, 0.f)});
+        hierarchy.emplace(entity);
+        entities.push_back(entity);
+    }
+    hierarchy.set_parent(entities[1], entities[0]);
+    hierarchy.set_parent(entities[2], entities[1]);
+    hierarchy.set_parent(entities[4], entities[3]);
+    hierarchy.set_parent(entities[5], entities[4]);
+
+    std::vector<Matrix4x4f> world;
+    auto update = [&]() {
+        world.resize(hierarchy.size());
+        return hierarchy.propagate([&](auto entity, auto pos, auto parent_pos) {
+            const auto &local = registry.get_component<Local>(entity);
+            const auto matrix = gfx::trs(local.position, Quaternionf::identity, Vector3f::ones);
+            world[pos] = parent_pos == Hierarchy::npos ? matrix : world[parent_pos] * matrix;
+        });
+    };
+    auto world_x = [&](const Entity entity) {
+        return world[hierarchy.position(entity)].c[3].x;
+    };
+
+    // The first pass visits all.
+    CHECK(update() == 6);
+    CHECK(world_x(entities[2]) == doctest::Approx(3.f));
+    CHECK(world_x(entities[5]) == doctest::Approx(3.f));
+    CHECK(!hierarchy.has_changes());
+    CHECK(update() == 0);
+
+    // Only the changed subtree is visited.
+    registry.get_component<Local>(entities[1]).position.x = 5.f;
+    hierarchy.mark_changed(entities[1]);
+    CHECK(update() == 2);
+    CHECK(world_x(entities[1]) == doctest::Approx(6.f));
+    CHECK(world_x(entities[2]) == doctest::Approx(7.f));
+    CHECK(world_x(entities[5]) == doctest::Approx(3.f));
+
+    registry.get_component<Local>(entities[5]).position.x = 2.f;
+    hierarchy.mark_changed(entities[5]);
+    CHECK(update() == 1);
+    CHECK(world_x(entities[5]) == doctest::Approx(4.f));
+
+    // A structural change visits all, since the positions moved.
+    hierarchy.set_parent(entities[3], entities[2]);
+    CHECK(update() == 6);
+    CHECK(world_x(entities[5]) == doctest::Approx(7.f + 4.f));
+}
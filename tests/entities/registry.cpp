@@ -4,6 +4,12 @@
 #include <nodec/entities/registry.hpp>
 
 #include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 TEST_CASE("Testing destroy_entities.") {
     using namespace nodec::entities;
@@ -668,4 +674,588 @@ TEST_CASE("Testing clear_component().") {
 //    logging::info("END", __FILE__, __LINE__);
 //
 //    return 0;
-//}
\ No newline at end of file
+//}
+TEST_CASE("Testing move of the registry.") {
+    using namespace nodec::entities;
+
+    auto check_moved = [](Registry &registry, Entity e0, Entity e1) {
+        CHECK(registry.all_of<int>(e0));
+        CHECK(registry.all_of<int, char>(e1));
+        CHECK(!registry.all_of<char>(e0));
+
+        std::size_t count = 0;
+        registry.view<int>().each([&](auto, auto &) { ++count; });
+        CHECK(count == 2);
+
+        registry.destroy_entity(e0);
+        CHECK(!registry.is_valid(e0));
+
+        count = 0;
+        registry.view<int>().each([&](auto, auto &) { ++count; });
+        CHECK(count == 1);
+
+        // The signals hand this registry.
+        Registry *signaled = nullptr;
+        registry.component_constructed<double>().connect([&](auto &reg, auto) { signaled = &reg; });
+        registry.emplace_component<double>(e1);
+        CHECK(signaled == &registry);
+        CHECK(registry.all_of<double>(e1));
+    };
+
+    Registry source;
+    const auto e0 = source.create_entity();
+    const auto e1 = source.create_entity();
+    source.emplace_component<int>(e0, 1);
+    source.emplace_component<int>(e1, 2);
+    source.emplace_component<char>(e1, 'a');
+
+    SUBCASE("move constructor") {
+        Registry moved = std::move(source);
+        check_moved(moved, e0, e1);
+    }
+
+    SUBCASE("move assignment") {
+        Registry moved;
+        const auto other = moved.create_entity();
+        moved.emplace_component<int>(other, 3);
+
+        moved = std::move(source);
+        check_moved(moved, e0, e1);
+    }
+}
+
+TEST_CASE("Testing create_entities.") {
+    using namespace nodec::entities;
+
+    Registry registry;
+
+    std::array<Entity, 4> recycled;
+    registry.create_entities(recycled.begin(), recycled.end());
+    registry.destroy_entity(recycled[1]);
+    registry.destroy_entity(recycled[3]);
+
+    std::vector<Entity> entities(10);
+    registry.create_entities(entities.begin(), entities.end());
+
+    for (const auto entity : entities) {
+        CHECK(registry.is_valid(entity));
+    }
+    CHECK(to_entity(entities[0]) == to_entity(recycled[3]));
+    CHECK(to_entity(entities[1]) == to_entity(recycled[1]));
+    CHECK(to_entity(entities[2]) == 4);
+    CHECK(to_entity(entities[9]) == 11);
+}
+
+TEST_CASE("Testing insert_components.") {
+    using namespace nodec::entities;
+
+    Registry registry;
+
+    std::vector<Entity> entities(100);
+    registry.create_entities(entities.begin(), entities.end());
+
+    registry.emplace_component<int>(entities[10], -1);
+
+    std::vector<Entity> constructed;
+    registry.component_constructed<int>().connect([&](auto &, auto entity) {
+        // All the components are constructed before the signals are emitted.
+        CHECK(registry.all_of<int>(entities.back()));
+        constructed.push_back(entity);
+    });
+    std::vector<std::size_t> batches;
+    registry.components_constructed<int>().connect([&](auto &, nodec::ArrayView<const Entity> batch) {
+        // The per-entity events come first.
+        CHECK(constructed.size() == batch.size());
+        batches.push_back(batch.size());
+    });
+
+    SUBCASE("with a value") {
+        CHECK(registry.insert_components<int>(entities.begin(), entities.end(), 7) == 99);
+        CHECK(constructed.size() == 99);
+        CHECK(batches == std::vector<std::size_t>{99});
+
+        for (std::size_t i = 0; i < entities.size(); ++i) {
+            CHECK(registry.get_component<int>(entities[i]) == (i == 10 ? -1 : 7));
+        }
+    }
+
+    SUBCASE("with a value range") {
+        std::vector<int> values(entities.size());
+        for (std::size_t i = 0; i < values.size(); ++i) values[i] = static_cast<int>(i);
+
+        CHECK(registry.insert_components<int>(entities.begin(), entities.end(), values.begin()) == 99);
+        CHECK(constructed.size() == 99);
+        CHECK(batches == std::vector<std::size_t>{99});
+
+        for (std::size_t i = 0; i < entities.size(); ++i) {
+            CHECK(registry.get_component<int>(entities[i]) == (i == 10 ? -1 : static_cast<int>(i)));
+        }
+    }
+
+    SUBCASE("with a value of the same pool") {
+        const std::string text(100, 'x');
+        registry.emplace_component<std::string>(entities[0], text);
+
+        // The pool grows while copying, which moves the given value.
+        registry.insert_components<std::string>(entities.begin() + 1, entities.end(),
+                                                registry.get_component<std::string>(entities[0]));
+        for (const auto entity : entities) {
+            CHECK(registry.get_component<std::string>(entity) == text);
+        }
+    }
+
+    SUBCASE("with an owning group") {
+        registry.emplace_component<double>(entities[3]);
+        registry.emplace_component<double>(entities[5]);
+        auto group = registry.group<int, double>();
+        CHECK(group.size() == 0);
+
+        registry.insert_components<int>(entities.begin(), entities.end());
+        CHECK(group.size() == 2);
+        CHECK(group.contains(entities[3]));
+        CHECK(group.contains(entities[5]));
+    }
+
+    SUBCASE("invalid entity") {
+        registry.destroy_entity(entities[50]);
+        CHECK_THROWS(registry.insert_components<int>(entities.begin(), entities.end()));
+        CHECK(constructed.empty());
+        CHECK(batches.empty());
+    }
+}
+
+TEST_CASE("Testing deferred component events.") {
+    using namespace nodec;
+    using namespace nodec::entities;
+
+    Registry registry;
+    registry.set_component_events_deferred(true);
+    CHECK(registry.component_events_deferred());
+
+    std::vector<Entity> entities(10);
+    registry.create_entities(entities.begin(), entities.end());
+
+    int immediate_count = 0;
+    registry.component_constructed<int>().connect([&](auto &, auto) { ++immediate_count; });
+    registry.component_destroyed<int>().connect([&](auto &, auto) { ++immediate_count; });
+
+    std::vector<Entity> constructed;
+    std::vector<Entity> destroyed;
+    int batch_count = 0;
+    registry.components_constructed<int>().connect([&](auto &, ArrayView<const Entity> batch) {
+        ++batch_count;
+        constructed.insert(constructed.end(), batch.begin(), batch.end());
+    });
+    registry.components_destroyed<int>().connect([&](auto &, ArrayView<const Entity> batch) {
+        ++batch_count;
+        for (const auto entity : batch) {
+            // The components are already gone at the flush.
+            CHECK(!registry.all_of<int>(entity));
+            destroyed.push_back(entity);
+        }
+    });
+
+    SUBCASE("the events are buffered until the flush") {
+        registry.emplace_component<int>(entities[0]);
+        registry.insert_components<int>(entities.begin() + 1, entities.end());
+        registry.remove_component<int>(entities[3]);
+        CHECK(constructed.empty());
+        CHECK(destroyed.empty());
+
+        registry.flush_component_events();
+        CHECK(immediate_count == 0);
+        CHECK(batch_count == 1);
+        CHECK(constructed.size() == 9);
+        CHECK(constructed[0] == entities[0]);
+        CHECK(std::find(constructed.begin(), constructed.end(), entities[3]) == constructed.end());
+        CHECK(destroyed.empty());
+
+        registry.flush_component_events();
+        CHECK(batch_count == 1);
+
+        registry.remove_component<int>(entities[5]);
+        registry.flush_component_events();
+        CHECK(batch_count == 2);
+        CHECK(destroyed == std::vector<Entity>{entities[5]});
+    }
+
+    SUBCASE("emplace then erase before the flush emits nothing") {
+        registry.emplace_component<int>(entities[0]);
+        registry.remove_component<int>(entities[0]);
+
+        registry.flush_component_events();
+        CHECK(batch_count == 0);
+        CHECK(constructed.empty());
+        CHECK(destroyed.empty());
+    }
+
+    SUBCASE("the events caused by the listeners are flushed too") {
+        registry.components_constructed<int>().connect([&](auto &reg, ArrayView<const Entity> batch) {
+            for (const auto entity : batch) {
+                reg.template emplace_component<float>(entity);
+            }
+        });
+        std::size_t float_count = 0;
+        registry.components_constructed<float>().connect([&](auto &, ArrayView<const Entity> batch) {
+            float_count += batch.size();
+        });
+
+        registry.insert_components<int>(entities.begin(), entities.end());
+        registry.flush_component_events();
+        CHECK(float_count == entities.size());
+    }
+
+    SUBCASE("switching off emits immediately") {
+        registry.set_component_events_deferred(false);
+        registry.emplace_component<int>(entities[0]);
+        CHECK(immediate_count == 1);
+        registry.flush_component_events();
+        CHECK(batch_count == 0);
+    }
+}
+
+TEST_CASE("Testing the order of deferred component events.") {
+    using namespace nodec;
+    using namespace nodec::entities;
+
+    Registry registry;
+    const auto entity = registry.create_entity();
+    registry.emplace_component<int>(entity, 1);
+    registry.set_component_events_deferred(true);
+
+    std::vector<std::string> log;
+    registry.components_constructed<int>().connect([&](auto &reg, ArrayView<const Entity> batch) {
+        for (const auto e : batch) log.push_back("constructed " + std::to_string(reg.template get_component<int>(e)));
+    });
+    registry.components_destroyed<int>().connect([&](auto &, ArrayView<const Entity> batch) {
+        for (const auto e : batch) log.push_back("destroyed " + std::to_string(static_cast<int>(e == entity)));
+    });
+
+    // Destroyed, then constructed again before the flush.
+    registry.remove_component<int>(entity);
+    registry.emplace_component<int>(entity, 2);
+    registry.flush_component_events();
+    CHECK(log == std::vector<std::string>{"destroyed 1", "constructed 2"});
+}
+
+TEST_CASE("Testing sort and sort_as.") {
+    using namespace nodec::entities;
+
+    Registry registry;
+
+    std::vector<Entity> entities(100);
+    registry.create_entities(entities.begin(), entities.end());
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+        registry.emplace_component<int>(entities[i], static_cast<int>((i * 37) % 100));
+        if (i % 3 != 0) registry.emplace_component<float>(entities[i], static_cast<float>(i));
+    }
+
+    registry.sort_by_value<int>([](const int &lhs, const int &rhs) { return lhs < rhs; });
+
+    int prev = -1;
+    registry.view<int>().each([&](auto, int &value) {
+        CHECK(prev < value);
+        prev = value;
+    });
+
+    registry.sort_as<float, int>();
+
+    // Both pools are now visited in the same order.
+    std::vector<Entity> int_order;
+    registry.view<int>().each([&](auto entity, int &) {
+        if (registry.all_of<float>(entity)) int_order.push_back(entity);
+    });
+    std::vector<Entity> float_order;
+    registry.view<float>().each([&](auto entity, float &) { float_order.push_back(entity); });
+    CHECK(int_order == float_order);
+
+    SUBCASE("owned pools cannot be sorted") {
+        registry.group<int>();
+        CHECK_THROWS(registry.sort_by_value<int>([](const int &lhs, const int &rhs) { return lhs < rhs; }));
+    }
+}
+
+TEST_CASE("Testing patch and dirty_view.") {
+    using namespace nodec::entities;
+
+    Registry registry;
+
+    std::vector<Entity> entities(10);
+    registry.create_entities(entities.begin(), entities.end());
+    registry.insert_components(entities.begin(), entities.end(), 0);
+    registry.insert_components(entities.begin(), entities.begin() + 5, 0.f);
+
+    CHECK(registry.patch<int>(entities[1], [](int &value) { value = 1; }) == 1);
+    CHECK(registry.mark_dirty<int>(entities[3]));
+    CHECK(registry.mark_dirty<int>(entities[3]));
+    CHECK(registry.mark_dirty<int>(entities[7]));
+    CHECK(!registry.mark_dirty<char>(entities[0]));
+    CHECK_THROWS(registry.patch<char>(entities[0], [](char &) {}));
+
+    CHECK(registry.is_dirty<int>(entities[1]));
+    CHECK(!registry.is_dirty<int>(entities[2]));
+
+    SUBCASE("only the dirty entities are visited, then cleared") {
+        auto view = registry.dirty_view<int>();
+        CHECK(view.size_hint() == 3);
+
+        std::vector<Entity> visited;
+        view.each([&](auto entity, int &) { visited.push_back(entity); });
+        CHECK(visited == std::vector<Entity>{entities[1], entities[3], entities[7]});
+
+        CHECK(view.size_hint() == 0);
+        CHECK(!registry.is_dirty<int>(entities[1]));
+
+        visited.clear();
+        view.each([&](auto entity, int &) { visited.push_back(entity); });
+        CHECK(visited.empty());
+    }
+
+    SUBCASE("with other components") {
+        std::vector<Entity> visited;
+        registry.dirty_view<int, float>().each([&](auto entity, int &, float &) { visited.push_back(entity); });
+        CHECK(visited == std::vector<Entity>{entities[1], entities[3]});
+        CHECK(!registry.is_dirty<int>(entities[7]));
+    }
+
+    SUBCASE("removed components are unmarked") {
+        registry.remove_component<int>(entities[3]);
+        registry.destroy_entity(entities[7]);
+        CHECK(!registry.is_dirty<int>(entities[3]));
+
+        std::vector<Entity> visited;
+        registry.dirty_view<int>().each([&](auto entity, int &) { visited.push_back(entity); });
+        CHECK(visited == std::vector<Entity>{entities[1]});
+    }
+
+    SUBCASE("entities marked while iterating are kept for the next pass") {
+        auto view = registry.dirty_view<int>();
+        view.each([&](auto entity, int &) {
+            registry.patch<int>(entity, [](int &value) { ++value; });
+        });
+        CHECK(view.size_hint() == 3);
+    }
+}
+
+namespace {
+
+enum class WideEntity : std::uint64_t {};
+
+} // namespace
+
+template<>
+struct nodec::entities::entity_traits<WideEntity>
+    : nodec::entities::basic_entity_traits<nodec::entities::entity_layout<WideEntity, 40, 24>> {};
+
+TEST_CASE("Testing custom identifier layout.") {
+    using namespace nodec::entities;
+    using traits_type = entity_traits<WideEntity>;
+
+    static_assert(traits_type::entity_mask == 0xFFFFFFFFFFull, "");
+    static_assert(traits_type::version_mask == 0xFFFFFFull, "");
+
+    const auto entity = traits_type::construct(0x123456789Aull, 0xABCDEu);
+    CHECK(traits_type::to_entity(entity) == 0x123456789Aull);
+    CHECK(traits_type::to_version(entity) == 0xABCDEu);
+    const WideEntity null = null_entity;
+    CHECK(null == traits_type::construct(traits_type::entity_mask, traits_type::version_mask));
+
+    BasicRegistry<WideEntity> registry;
+
+    std::vector<WideEntity> entities(10000);
+    registry.create_entities(entities.begin(), entities.end());
+    registry.insert_components(entities.begin(), entities.end(), 1);
+    CHECK(registry.is_valid(entities.back()));
+    CHECK(to_entity(entities.back()) == 9999u);
+
+    registry.destroy_entity(entities[5]);
+    CHECK(!registry.is_valid(entities[5]));
+
+    const auto recycled = registry.create_entity();
+    CHECK(to_entity(recycled) == 5u);
+    CHECK(to_version(recycled) == 1u);
+
+    int sum = 0;
+    registry.view<int>().each([&](auto, int &value) { sum += value; });
+    CHECK(sum == 9999);
+}
+
+TEST_CASE("Testing the versions wrap in the version part.") {
+    using namespace nodec::entities;
+
+    Registry registry;
+    auto entity = registry.create_entity();
+
+    // The version mask is the tombstone version, so it is skipped.
+    for (int i = 0; i < 4095; ++i) {
+        registry.destroy_entity(entity);
+        entity = registry.create_entity();
+        CHECK(to_version(entity) != entity_traits<Entity>::version_mask);
+    }
+    CHECK(to_entity(entity) == 0u);
+    CHECK(to_version(entity) == 0u);
+}
+
+TEST_CASE("Testing memory_stats and compact.") {
+    using namespace nodec::entities;
+
+    Registry registry;
+
+    std::vector<Entity> entities(20000);
+    registry.create_entities(entities.begin(), entities.end());
+    registry.insert_components(entities.begin(), entities.end(), 1);
+    registry.insert_components(entities.begin(), entities.end(), 1.0);
+
+    auto stats = registry.memory_stats();
+    CHECK(stats.entities == 20000);
+    CHECK(stats.entity_capacity == 20000);
+    CHECK(stats.pool_count == 2);
+    CHECK(stats.storages.size == 40000);
+    CHECK(stats.signature_bytes > 0);
+    CHECK(registry.storage_stats<int>().size == 20000);
+    CHECK(registry.storage_stats<char>().size == 0);
+    const auto peak_bytes = stats.total_bytes();
+
+    registry.destroy_entities(entities.begin() + 100, entities.end());
+    registry.compact();
+
+    stats = registry.memory_stats();
+    CHECK(stats.entities == 100);
+    CHECK(stats.entity_capacity == 20000);
+    CHECK(stats.storages.size == 200);
+    CHECK(stats.total_bytes() < peak_bytes / 2);
+
+    std::size_t visited = 0;
+    registry.each_storage_stats([&](const nodec::type_info &, const StorageStats &pool_stats) {
+        CHECK(pool_stats.size == 100);
+        ++visited;
+    });
+    CHECK(visited == 2);
+
+    // The released identifiers are recycled with new versions.
+    const auto entity = registry.create_entity();
+    CHECK(to_version(entity) == 1u);
+    CHECK(registry.get_component<int>(entities[0]) == 1);
+}
+
+TEST_CASE("Testing instantiate.") {
+    using namespace nodec::entities;
+
+    Registry registry;
+
+    const auto prototype = registry.create_entity();
+    registry.emplace_component<int>(prototype, 7);
+    registry.emplace_component<std::string>(prototype, "bullet");
+    registry.emplace_component<char>(prototype, 'b');
+
+    std::vector<std::size_t> batches;
+    int per_entity = 0;
+    nodec::signals::Connection batch_connection = registry.components_constructed<std::string>().connect(
+        [&](Registry &, nodec::ArrayView<const Entity> entities) { batches.push_back(entities.size()); });
+    nodec::signals::Connection entity_connection = registry.component_constructed<std::string>().connect(
+        [&](Registry &, const Entity) { ++per_entity; });
+
+    std::vector<Entity> clones;
+    registry.instantiate(prototype, 100, std::back_inserter(clones));
+
+    CHECK(clones.size() == 100);
+    for (const auto clone : clones) {
+        CHECK(clone != prototype);
+        CHECK(registry.get_component<int>(clone) == 7);
+        CHECK(registry.get_component<std::string>(clone) == "bullet");
+        CHECK(registry.get_component<char>(clone) == 'b');
+        CHECK(!registry.all_of<double>(clone));
+    }
+
+    // One batch per pool, and the per-entity events as well.
+    CHECK(batches == std::vector<std::size_t>{100});
+    CHECK(per_entity == 100);
+
+    SUBCASE("deferred events") {
+        registry.set_component_events_deferred(true);
+        std::vector<Entity> more(10);
+        registry.instantiate(prototype, more.size(), more.begin());
+        CHECK(batches.size() == 1);
+
+        registry.flush_component_events();
+        CHECK(batches == std::vector<std::size_t>{100, 10});
+        CHECK(per_entity == 100);
+    }
+
+    SUBCASE("invalid prototype") {
+        registry.destroy_entity(prototype);
+        CHECK_THROWS(registry.instantiate(prototype, 1, clones.begin()));
+    }
+
+    SUBCASE("not copyable component") {
+        registry.emplace_component<std::unique_ptr<int>>(prototype);
+        CHECK_THROWS(registry.instantiate(prototype, 1, clones.begin()));
+    }
+}
+
+namespace {
+
+template<int Tag, std::size_t N>
+struct SeqPadding {};
+
+// Takes the seq indices of the padding types until the index reaches the last.
+template<int Tag, std::size_t... Is>
+void take_seq_indices(const nodec::type_seq_index_type last, std::index_sequence<Is...>) {
+    bool done = false;
+    ((done = done || !(nodec::type_seq_index<SeqPadding<Tag, Is>>::value() < last)), ...);
+}
+
+struct LowComponent {
+    int value;
+};
+
+struct HighComponent {
+    int value;
+};
+
+struct LateComponent {
+    int value;
+};
+
+} // namespace
+
+TEST_CASE("Testing the signatures widened while walking the components.") {
+    using namespace nodec::entities;
+
+    // Puts each component in its own signature word.
+    const auto low = nodec::type_seq_index<LowComponent>::value();
+    take_seq_indices<0>((low / 64 + 1) * 64 - 1, std::make_index_sequence<128>{});
+    const auto high = nodec::type_seq_index<HighComponent>::value();
+    take_seq_indices<1>((high / 64 + 1) * 64 + (low % 64 == 0) - 1, std::make_index_sequence<128>{});
+    const auto late = nodec::type_seq_index<LateComponent>::value();
+    REQUIRE(high / 64 == low / 64 + 1);
+    REQUIRE(late / 64 == high / 64 + 1);
+    REQUIRE(late % 64 != low % 64);
+
+    Registry registry;
+    const auto other = registry.create_entity();
+    const auto entity = registry.create_entity();
+    registry.emplace_component<LowComponent>(entity);
+    registry.emplace_component<HighComponent>(entity);
+
+    SUBCASE("visit") {
+        std::vector<nodec::type_seq_index_type> visited;
+        registry.visit(entity, [&](const nodec::type_info &type, void *) {
+            visited.push_back(type.seq_index());
+            if (type.seq_index() == high) registry.emplace_component<LateComponent>(other);
+        });
+
+        CHECK(visited == std::vector<nodec::type_seq_index_type>{high, low});
+    }
+
+    SUBCASE("remove_all_components") {
+        registry.component_destroyed<HighComponent>().connect([&](auto &, auto) {
+            registry.emplace_component<LateComponent>(other);
+        });
+        registry.remove_all_components(entity);
+
+        CHECK(!registry.any_of<LowComponent, HighComponent>(entity));
+        CHECK(registry.all_of<LateComponent>(other));
+        CHECK(!registry.all_of<LateComponent>(entity));
+    }
+}
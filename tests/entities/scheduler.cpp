@@ -0,0 +1,121 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include <nodec/concurrent/thread_pool_executor.hpp>
+#include <nodec/entities/scheduler.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Position {
+    float x;
+};
+
+struct Velocity {
+    float x;
+};
+
+struct Health {
+    int value;
+};
+
+} // namespace
+
+TEST_CASE("Testing the conflict graph.") {
+    using namespace nodec::entities;
+
+    Scheduler scheduler;
+    const auto move = scheduler.add_system("move", reads<Velocity>, writes<Position>, [](Registry &) {});
+    const auto heal = scheduler.add_system("heal", reads<>, writes<Health>, [](Registry &) {});
+    const auto render = scheduler.add_system("render", reads<Position, Health>, writes<>, [](Registry &) {});
+    const auto log = scheduler.add_system("log", reads<const Position>, writes<>, [](Registry &) {});
+    const auto save = scheduler.add_exclusive_system("save", [](Registry &) {});
+
+    Registry registry;
+    scheduler.run(registry);
+
+    CHECK(scheduler.system_count() == 5);
+    CHECK(scheduler.system_name(render) == "render");
+    CHECK(scheduler.dependencies(move).empty());
+    CHECK(scheduler.dependencies(heal).empty());
+    CHECK(scheduler.dependencies(render) == std::vector<std::size_t>{move, heal});
+    CHECK(scheduler.dependencies(log) == std::vector<std::size_t>{move});
+    CHECK(scheduler.dependencies(save) == std::vector<std::size_t>{move, heal, render, log});
+}
+
+TEST_CASE("Testing run on an executor.") {
+    using namespace nodec::entities;
+
+    Registry registry;
+    std::vector<Entity> entities(1000);
+    registry.create_entities(entities.begin(), entities.end());
+    registry.insert_components(entities.begin(), entities.end(), Position{0.f});
+    registry.insert_components(entities.begin(), entities.end(), Velocity{1.f});
+    registry.insert_components(entities.begin(), entities.end(), Health{10});
+
+    nodec::concurrent::ThreadPoolExecutor executor{4};
+    Scheduler scheduler;
+
+    std::atomic<int> running{0};
+    std::atomic<int> max_running{0};
+    auto track = [&]() {
+        const auto now = ++running;
+        int expected = max_running;
+        while (now > expected && !max_running.compare_exchange_weak(expected, now)) {}
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        --running;
+    };
+
+    scheduler.add_system("move", reads<Velocity>, writes<Position>, [&](Registry &registry) {
+        track();
+        registry.view<Position, Velocity>().each([](auto, Position &position, Velocity &velocity) { position.x += velocity.x; });
+    });
+    scheduler.add_system("damage", reads<>, writes<Health>, [&](Registry &registry) {
+        track();
+        registry.view<Health>().each([](auto, Health &health) { health.value -= 1; });
+    });
+
+    float sum = 0.f;
+    const auto sum_positions = scheduler.add_system("sum", reads<Position>, writes<>, [&](Registry &registry) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        registry.view<const Position>().each([&](auto, const Position &position) { sum += position.x; });
+    });
+
+    scheduler.run(registry, executor);
+
+    // The conflicting system saw the writes, and the others overlapped.
+    CHECK(sum == 1000.f);
+    CHECK(registry.get_component<Health>(entities[0]).value == 9);
+    CHECK(max_running == 2);
+
+    const auto &stats = scheduler.system_stats(sum_positions);
+    CHECK(stats.start >= scheduler.system_stats(0).finish);
+    CHECK(stats.finish >= stats.start);
+    CHECK(scheduler.frame_elapsed() >= stats.finish);
+    CHECK(scheduler.system_stats(0).elapsed >= std::chrono::milliseconds(20));
+
+    // move (20 ms) -> sum (10 ms) is longer than damage (20 ms).
+    const auto path = scheduler.critical_path();
+    CHECK(path.size() == 2);
+    CHECK(path.back() == sum_positions);
+}
+
+TEST_CASE("Testing exceptions in systems.") {
+    using namespace nodec::entities;
+
+    Registry registry;
+    nodec::concurrent::ThreadPoolExecutor executor{2};
+    Scheduler scheduler;
+
+    bool later_ran = false;
+    scheduler.add_system("fail", reads<>, writes<Position>, [](Registry &) { throw std::runtime_error("failed"); });
+    scheduler.add_system("later", reads<Position>, writes<>, [&](Registry &) { later_ran = true; });
+
+    CHECK_THROWS_AS(scheduler.run(registry, executor), std::runtime_error);
+    CHECK(later_ran);
+}
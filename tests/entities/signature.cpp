@@ -0,0 +1,91 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include <nodec/entities/registry.hpp>
+#include <nodec/entities/signature.hpp>
+
+#include <string>
+#include <vector>
+
+TEST_CASE("Testing ComponentSignatures.") {
+    using namespace nodec::entities;
+
+    ComponentSignatures signatures;
+    signatures.reserve_bit(3);
+    CHECK(signatures.stride() == 1);
+
+    signatures.set(0, 3);
+    signatures.set(5, 0);
+    signatures.set(5, 3);
+    CHECK(signatures.test(0, 3));
+    CHECK(!signatures.test(0, 0));
+    CHECK(!signatures.test(1, 3));
+    CHECK(!signatures.test(100, 3));
+    CHECK(signatures.none(1));
+
+    // Widening keeps the bits.
+    signatures.reserve_bit(130);
+    CHECK(signatures.stride() == 3);
+    CHECK(signatures.test(0, 3));
+    CHECK(signatures.test(5, 0));
+    CHECK(!signatures.test(5, 130));
+
+    signatures.set(5, 130);
+    std::vector<std::size_t> indices;
+    signatures.each_reverse(5, [&](auto index) { indices.push_back(index); });
+    CHECK(indices == std::vector<std::size_t>{130, 3, 0});
+
+    signatures.reset(5, 3);
+    signatures.reset(5, 0);
+    signatures.reset(5, 130);
+    CHECK(signatures.none(5));
+}
+
+TEST_CASE("Testing the registry signatures.") {
+    using namespace nodec::entities;
+
+    Registry registry;
+
+    const auto entity = registry.create_entity();
+    const auto other = registry.create_entity();
+    registry.emplace_component<int>(entity);
+    registry.emplace_component<std::string>(entity);
+    registry.emplace_component<double>(other);
+
+    CHECK(registry.all_of<int, std::string>(entity));
+    CHECK(!registry.all_of<int, double>(entity));
+    CHECK(registry.any_of<double, std::string>(entity));
+    CHECK(!registry.any_of<double, char>(entity));
+
+    std::vector<const nodec::type_info *> visited;
+    registry.visit(entity, [&](const auto &type, void *) { visited.push_back(&type); });
+    CHECK(visited.size() == 2);
+
+    SUBCASE("destroy_entity removes only the used components") {
+        registry.destroy_entity(entity);
+        CHECK(!registry.all_of<int>(entity));
+        CHECK(registry.all_of<double>(other));
+
+        // The recycled identifier starts with an empty signature.
+        const auto recycled = registry.create_entity();
+        CHECK(to_entity(recycled) == to_entity(entity));
+        CHECK(!registry.any_of<int, std::string>(recycled));
+    }
+
+    SUBCASE("components added by the destroy listeners are removed as well") {
+        registry.component_destroyed<int>().connect([](auto &registry, auto entity) {
+            registry.template emplace_component<char>(entity);
+        });
+        registry.destroy_entity(entity);
+
+        const auto recycled = registry.create_entity();
+        CHECK(!registry.any_of<char>(recycled));
+    }
+
+    SUBCASE("stale identifiers have no components") {
+        registry.destroy_entity(entity);
+        const auto recycled = registry.create_entity();
+        registry.emplace_component<int>(recycled);
+        CHECK(!registry.all_of<int>(entity));
+    }
+}
@@ -0,0 +1,255 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include <nodec/entities/registry.hpp>
+#include <nodec/entities/snapshot.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Position {
+    float x, y;
+};
+
+struct Name {
+    std::string value;
+};
+
+} // namespace
+
+namespace nodec {
+namespace entities {
+
+template<>
+struct component_serializer<Name> {
+    static void save(std::ostream &stream, const Name &name) {
+        const auto size = static_cast<std::uint32_t>(name.value.size());
+        stream.write(reinterpret_cast<const char *>(&size), sizeof(size));
+        stream.write(name.value.data(), size);
+    }
+
+    static void load(std::istream &stream, Name &name) {
+        std::uint32_t size;
+        stream.read(reinterpret_cast<char *>(&size), sizeof(size));
+        name.value.resize(size);
+        stream.read(&name.value[0], size);
+    }
+};
+
+} // namespace entities
+} // namespace nodec
+
+TEST_CASE("Testing snapshot and restore.") {
+    using namespace nodec::entities;
+
+    Registry source;
+
+    std::vector<Entity> entities(10);
+    source.create_entities(entities.begin(), entities.end());
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+        source.emplace_component<Position>(entities[i], static_cast<float>(i), -static_cast<float>(i));
+        if (i % 2 == 0) source.emplace_component<Name>(entities[i], "entity " + std::to_string(i));
+    }
+    source.destroy_entity(entities[3]);
+    source.destroy_entity(entities[8]);
+
+    std::stringstream stream;
+    Snapshot{source}.entities(stream).components<Position, Name, int>(stream);
+
+    Registry destination;
+    const auto stale = destination.create_entity();
+    destination.emplace_component<int>(stale, 1);
+
+    // The components loaded in place are told to both of the construction signals.
+    std::size_t constructed = 0, batched = 0;
+    nodec::signals::Connection constructed_connection = destination.component_constructed<Position>().connect(
+        [&](Registry &, const Entity) { ++constructed; });
+    nodec::signals::Connection batched_connection = destination.components_constructed<Position>().connect(
+        [&](Registry &, nodec::ArrayView<const Entity> batch) { batched += batch.size(); });
+
+    SnapshotLoader{destination}.entities(stream).components<Position, Name, int>(stream);
+    CHECK(constructed == 8);
+    CHECK(batched == 8);
+
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+        const auto entity = entities[i];
+        CHECK(destination.is_valid(entity) == source.is_valid(entity));
+        if (!source.is_valid(entity)) continue;
+
+        CHECK(destination.get_component<Position>(entity).x == static_cast<float>(i));
+        CHECK(destination.get_component<Position>(entity).y == -static_cast<float>(i));
+        CHECK(destination.all_of<Name>(entity) == (i % 2 == 0));
+        if (i % 2 == 0) {
+            CHECK(destination.get_component<Name>(entity).value == "entity " + std::to_string(i));
+        }
+    }
+    CHECK(!destination.all_of<int>(entities[0]));
+
+    // The packed order is kept.
+    std::vector<Entity> source_order, destination_order;
+    source.view<Position>().each([&](auto entity, auto &) { source_order.push_back(entity); });
+    destination.view<Position>().each([&](auto entity, auto &) { destination_order.push_back(entity); });
+    CHECK(source_order == destination_order);
+
+    // The free list is kept, so the identifiers are recycled in the same order.
+    CHECK(destination.create_entity() == source.create_entity());
+    CHECK(destination.create_entity() == source.create_entity());
+    CHECK(destination.create_entity() == source.create_entity());
+}
+
+TEST_CASE("Testing a broken snapshot.") {
+    using namespace nodec::entities;
+
+    Registry source;
+    const auto entity = source.create_entity();
+    source.emplace_component<Position>(entity, 1.f, 2.f);
+
+    std::stringstream stream;
+    Snapshot{source}.entities(stream).components<Position>(stream);
+
+    auto data = stream.str();
+    data.resize(data.size() - 1);
+    std::stringstream broken{data};
+
+    Registry destination;
+    CHECK_THROWS(SnapshotLoader{destination}.entities(broken).components<Position>(broken));
+}
+
+TEST_CASE("Testing a snapshot of another build.") {
+    using namespace nodec::entities;
+
+    Registry source;
+    const auto entity = source.create_entity();
+    source.emplace_component<Position>(entity, 1.f, 2.f);
+
+    std::stringstream stream;
+    Snapshot{source}.entities(stream).components<Position>(stream);
+    const auto data = stream.str();
+
+    SUBCASE("not a snapshot") {
+        auto broken = data;
+        broken[0] = 'X';
+        std::stringstream input{broken};
+
+        Registry destination;
+        const auto kept = destination.create_entity();
+        CHECK_THROWS(SnapshotLoader{destination}.entities(input));
+        CHECK(destination.is_valid(kept));
+    }
+
+    SUBCASE("another component layout") {
+        std::stringstream input{data};
+
+        Registry destination;
+        SnapshotLoader loader{destination};
+        loader.entities(input);
+        CHECK_THROWS(loader.components<double>(input));
+        CHECK(!destination.all_of<double>(entity));
+    }
+}
+
+TEST_CASE("Testing a snapshot with a duplicated entity.") {
+    using namespace nodec::entities;
+
+    Registry source;
+    std::vector<Entity> entities(2);
+    source.create_entities(entities.begin(), entities.end());
+    source.emplace_component<Position>(entities[0], 1.f, 2.f);
+    source.emplace_component<Position>(entities[1], 3.f, 4.f);
+
+    std::stringstream stream;
+    Snapshot{source}.entities(stream).components<Position>(stream);
+
+    // Overwrite the second packed entity with the first.
+    auto data = stream.str();
+    const auto packed_offset = data.size() - 2 * sizeof(Position) - 2 * sizeof(Entity);
+    data.replace(packed_offset + sizeof(Entity), sizeof(Entity), data.substr(packed_offset, sizeof(Entity)));
+    std::stringstream input{data};
+
+    Registry destination;
+    SnapshotLoader loader{destination};
+    loader.entities(input);
+    CHECK_THROWS(loader.components<Position>(input));
+
+    // The section is not loaded at all.
+    CHECK(!destination.all_of<Position>(entities[0]));
+    CHECK(!destination.all_of<Position>(entities[1]));
+}
+
+TEST_CASE("Testing a broken entity section.") {
+    using namespace nodec::entities;
+    using traits_type = entity_traits<Entity>;
+
+    Registry source;
+    std::vector<Entity> entities(4);
+    source.create_entities(entities.begin(), entities.end());
+    source.destroy_entity(entities[1]);
+    source.destroy_entity(entities[2]);
+
+    std::stringstream stream;
+    Snapshot{source}.entities(stream);
+    auto data = stream.str();
+
+    // magic, version, entity size and count, then the entity list and the free list.
+    const std::size_t count_offset = 3 * sizeof(std::uint32_t);
+    const std::size_t list_offset = count_offset + sizeof(std::uint64_t);
+    const auto write_at = [&](std::size_t offset, auto value) {
+        data.replace(offset, sizeof(value), reinterpret_cast<const char *>(&value), sizeof(value));
+    };
+
+    Registry destination;
+    const auto kept = destination.create_entity();
+    destination.emplace_component<Position>(kept, 1.f, 2.f);
+
+    SUBCASE("the list is cut") {
+        data.resize(list_offset + 2 * sizeof(Entity));
+    }
+
+    SUBCASE("the count exceeds the data") {
+        write_at(count_offset, std::uint64_t{1'000'000});
+    }
+
+    SUBCASE("the count exceeds the numbers") {
+        write_at(count_offset, std::uint64_t{1} << 40);
+    }
+
+    SUBCASE("the free list has a cycle") {
+        // The last released slot points back to the first one.
+        write_at(list_offset + sizeof(Entity), traits_type::construct(2, 1));
+    }
+
+    SUBCASE("a released slot is out of the free list") {
+        write_at(list_offset + 4 * sizeof(Entity), Entity{null_entity});
+    }
+
+    std::stringstream input{data};
+    CHECK_THROWS(SnapshotLoader{destination}.entities(input));
+
+    // The registry is left as it was.
+    CHECK(destination.is_valid(kept));
+    CHECK(destination.get_component<Position>(kept).y == 2.f);
+}
+
+TEST_CASE("Testing the entity list is restored across the pages.") {
+    using namespace nodec::entities;
+
+    Registry source;
+    std::vector<Entity> entities(10000);
+    source.create_entities(entities.begin(), entities.end());
+    for (std::size_t i = 0; i < entities.size(); i += 3) source.destroy_entity(entities[i]);
+
+    std::stringstream stream;
+    Snapshot{source}.entities(stream);
+
+    Registry destination;
+    SnapshotLoader{destination}.entities(stream);
+
+    for (const auto entity : entities) {
+        CHECK(destination.is_valid(entity) == source.is_valid(entity));
+    }
+    CHECK(destination.create_entity() == source.create_entity());
+}
@@ -5,6 +5,31 @@
 
 #include <array>
 #include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace nodec {
+namespace entities {
+
+// Use the sparse table backend for 64 bits entities to test the selection.
+template<>
+struct sparse_container_for<std::uint64_t> {
+    using type = containers::SparseTable<std::size_t>;
+};
+
+struct PagedComponent {
+    int value;
+};
+
+struct Tag {};
+
+template<>
+struct component_traits<PagedComponent> {
+    static constexpr std::size_t page_size = 4;
+};
+
+} // namespace entities
+} // namespace nodec
 
 TEST_CASE("Testing storage iterator.") {
     using namespace nodec::entities;
@@ -81,4 +106,251 @@ TEST_CASE("Testing contains().") {
     storage.emplace(0, 0);
 
     CHECK(storage.contains(0));
-}
\ No newline at end of file
+}
+TEST_CASE("Testing sparse container backends.") {
+    using namespace nodec::entities;
+
+    static_assert(std::is_same<sparse_container_for_t<std::uint32_t>, nodec::containers::PagedSparseArray<std::size_t>>::value, "");
+    static_assert(std::is_same<sparse_container_for_t<std::uint64_t>, nodec::containers::SparseTable<std::size_t>>::value, "");
+
+    BasicStorage<std::uint32_t, int> paged;
+    BasicStorage<std::uint64_t, int> table;
+
+    for (int i = 0; i < 10000; i += 3) {
+        paged.emplace(static_cast<std::uint32_t>(i), i);
+        table.emplace(static_cast<std::uint64_t>(i), i);
+    }
+    paged.erase(300);
+    table.erase(300);
+
+    for (int i = 0; i < 10000; ++i) {
+        const bool expected = (i % 3 == 0) && i != 300;
+        CHECK(paged.contains(static_cast<std::uint32_t>(i)) == expected);
+        CHECK(table.contains(static_cast<std::uint64_t>(i)) == expected);
+        if (expected) {
+            CHECK(paged.get(static_cast<std::uint32_t>(i)) == i);
+            CHECK(table.get(static_cast<std::uint64_t>(i)) == i);
+        }
+    }
+}
+
+TEST_CASE("Testing insert().") {
+    using namespace nodec::entities;
+
+    BasicStorage<std::uint32_t, int> storage;
+    storage.emplace(2, -1);
+
+    std::array<std::uint32_t, 4> entities{0, 2, 5, 9};
+    std::array<int, 4> values{10, 20, 50, 90};
+
+    CHECK(storage.insert(entities.begin(), entities.end(), values.begin()) == 3);
+    CHECK(storage.size() == 4);
+    CHECK(storage.get(0) == 10);
+    CHECK(storage.get(2) == -1);
+    CHECK(storage.get(5) == 50);
+    CHECK(storage.get(9) == 90);
+
+    std::array<std::uint32_t, 2> others{3, 4};
+    CHECK(storage.insert(others.begin(), others.end(), 1) == 2);
+    CHECK(storage.get(3) == 1);
+    CHECK(storage.get(4) == 1);
+
+    CHECK(storage.insert(others.begin(), others.begin()) == 0);
+}
+
+TEST_CASE("Testing paged component storage.") {
+    using namespace nodec::entities;
+
+    static_assert(std::is_same<instance_container_for_t<int>, std::vector<int>>::value, "");
+    static_assert(std::is_same<instance_container_for_t<PagedComponent>,
+                               nodec::containers::BasicPagedVector<PagedComponent, 4>>::value,
+                  "");
+
+    BasicStorage<std::uint32_t, PagedComponent> storage;
+
+    auto *first = &storage.emplace(0, PagedComponent{0}).first;
+    for (std::uint32_t i = 1; i < 100; ++i) {
+        storage.emplace(i, PagedComponent{static_cast<int>(i)});
+    }
+
+    // Growing never relocates the components.
+    CHECK(first == storage.try_get(0));
+    CHECK(first->value == 0);
+
+    std::array<std::uint32_t, 3> entities{200, 201, 202};
+    storage.insert(entities.begin(), entities.end(), PagedComponent{7});
+    CHECK(first == storage.try_get(0));
+
+    // Erasing moves the last component into the hole.
+    storage.erase(0);
+    CHECK(storage.try_get(0) == nullptr);
+    CHECK(storage.get(202).value == 7);
+    for (std::uint32_t i = 1; i < 100; ++i) {
+        CHECK(storage.get(i).value == static_cast<int>(i));
+    }
+}
+
+TEST_CASE("Testing sort().") {
+    using namespace nodec::entities;
+
+    BasicStorage<std::uint32_t, int> storage;
+
+    std::array<std::pair<std::uint32_t, int>, 6> elements{
+        {{3, 30}, {1, 50}, {4, 10}, {0, 60}, {5, 20}, {2, 40}}};
+    for (const auto &element : elements) {
+        storage.emplace(element.first, element.second);
+    }
+
+    auto check_order = [&](const std::vector<std::uint32_t> &expected) {
+        std::vector<std::uint32_t> actual;
+        for (const auto entity : storage) {
+            actual.push_back(entity);
+        }
+        CHECK(actual == expected);
+
+        for (const auto &element : elements) {
+            CHECK(storage.get(element.first) == element.second);
+        }
+    };
+
+    SUBCASE("by entities") {
+        storage.sort([](const std::uint32_t lhs, const std::uint32_t rhs) { return lhs < rhs; });
+        check_order({0, 1, 2, 3, 4, 5});
+    }
+
+    SUBCASE("by values") {
+        storage.sort_by_value([](const int &lhs, const int &rhs) { return lhs < rhs; });
+        check_order({4, 5, 3, 2, 1, 0});
+    }
+
+    SUBCASE("with insertion sort") {
+        storage.sort_by_value([](const int &lhs, const int &rhs) { return lhs > rhs; }, nodec::InsertionSort{});
+        check_order({0, 1, 2, 3, 5, 4});
+    }
+}
+
+TEST_CASE("Testing sort_as().") {
+    using namespace nodec::entities;
+
+    BasicStorage<std::uint32_t, int> from;
+    BasicStorage<std::uint32_t, char> to;
+
+    for (std::uint32_t entity : {5, 3, 1, 4}) {
+        from.emplace(entity, static_cast<int>(entity));
+    }
+    for (std::uint32_t entity : {0, 1, 2, 3, 4}) {
+        to.emplace(entity, static_cast<char>('a' + entity));
+    }
+
+    to.sort_as(from);
+
+    std::vector<std::uint32_t> actual;
+    for (const auto entity : to) {
+        actual.push_back(entity);
+    }
+
+    // The shared entities follow the order of the other storage.
+    REQUIRE(actual.size() == 5);
+    CHECK(std::vector<std::uint32_t>(actual.begin(), actual.begin() + 3) == std::vector<std::uint32_t>{4, 1, 3});
+    for (std::uint32_t entity = 0; entity < 5; ++entity) {
+        CHECK(to.get(entity) == static_cast<char>('a' + entity));
+    }
+}
+
+TEST_CASE("Testing empty type storage.") {
+    using namespace nodec::entities;
+
+    using Storage = BasicStorage<std::uint32_t, Tag>;
+    static_assert(Storage::is_empty_value, "");
+    static_assert(std::is_same<Storage::reference, Tag>::value, "The empty types must be returned by value.");
+    static_assert(std::is_empty<instance_container_for_t<Tag>>::value, "");
+
+    Storage storage;
+
+    CHECK(storage.emplace(3).second);
+    CHECK(!storage.emplace(3).second);
+
+    std::array<std::uint32_t, 3> entities{1, 5, 7};
+    CHECK(storage.insert(entities.begin(), entities.end()) == 3);
+    CHECK(storage.size() == 4);
+    CHECK(storage.contains(5));
+    CHECK(storage.try_get(5) != nullptr);
+    CHECK(storage.try_get(2) == nullptr);
+
+    CHECK(storage.erase(1));
+    CHECK(!storage.contains(1));
+    CHECK(storage.contains(7));
+    CHECK(storage.index(7) < storage.size());
+
+    storage.sort([](const std::uint32_t lhs, const std::uint32_t rhs) { return lhs < rhs; });
+    std::vector<std::uint32_t> actual;
+    for (const auto entity : storage) {
+        actual.push_back(entity);
+    }
+    CHECK(actual == std::vector<std::uint32_t>{3, 5, 7});
+}
+
+TEST_CASE("Testing stats and shrink_to_fit.") {
+    using namespace nodec::entities;
+
+    auto test = [](auto &storage, auto entity_tag) {
+        using Entity = decltype(entity_tag);
+
+        for (std::uint32_t i = 0; i < 10000; ++i) {
+            storage.emplace(static_cast<Entity>(i), static_cast<int>(i));
+        }
+
+        auto stats = storage.stats();
+        CHECK(stats.size == 10000);
+        CHECK(stats.capacity >= 10000);
+        CHECK(stats.packed_bytes >= 10000 * sizeof(Entity));
+        CHECK(stats.instance_bytes >= 10000 * sizeof(int));
+        CHECK(stats.sparse_capacity >= 10000);
+        CHECK(stats.sparse_occupancy() > 0.0);
+        CHECK(stats.total_bytes() > stats.packed_bytes + stats.instance_bytes);
+        const auto full_bytes = stats.total_bytes();
+
+        for (std::uint32_t i = 10; i < 10000; ++i) {
+            storage.erase(static_cast<Entity>(i));
+        }
+        CHECK(storage.stats().total_bytes() >= full_bytes / 2);
+
+        storage.shrink_to_fit();
+        stats = storage.stats();
+        CHECK(stats.size == 10);
+        CHECK(stats.capacity == 10);
+        CHECK(stats.total_bytes() < full_bytes / 4);
+
+        for (std::uint32_t i = 0; i < 10; ++i) {
+            CHECK(storage.get(static_cast<Entity>(i)) == static_cast<int>(i));
+        }
+    };
+
+    SUBCASE("paged sparse array") {
+        BasicStorage<std::uint32_t, int> storage;
+        test(storage, std::uint32_t{});
+    }
+
+    SUBCASE("sparse table") {
+        BasicStorage<std::uint64_t, int> storage;
+        test(storage, std::uint64_t{});
+    }
+}
+
+TEST_CASE("Testing insert() on high entity numbers.") {
+    using namespace nodec::entities;
+
+    BasicStorage<std::uint32_t, int> inserted;
+    BasicStorage<std::uint32_t, int> emplaced;
+
+    std::vector<std::uint32_t> entities;
+    for (std::uint32_t i = 0; i < 10; ++i) entities.push_back(1'000'000 - 10 + i);
+
+    CHECK(inserted.insert(entities.begin(), entities.end(), 1) == 10);
+    for (const auto entity : entities) emplaced.emplace(entity, 1);
+
+    // Only the pages the entities fall in are allocated.
+    CHECK(inserted.stats().sparse_bytes == emplaced.stats().sparse_bytes);
+    CHECK(inserted.stats().sparse_capacity == emplaced.stats().sparse_capacity);
+    CHECK(inserted.get(entities.back()) == 1);
+}
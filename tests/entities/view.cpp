@@ -0,0 +1,168 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include <nodec/concurrent/thread_pool_executor.hpp>
+#include <nodec/entities/registry.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("Testing each_parallel.") {
+    using namespace nodec::entities;
+
+    Registry registry;
+    nodec::concurrent::ThreadPoolExecutor executor{4};
+
+    std::vector<Entity> entities(1000);
+    for (auto &entity : entities) {
+        entity = registry.create_entity();
+        registry.emplace_component<int>(entity, 0);
+        if (nodec::entities::to_entity(entity) % 2 == 0) {
+            registry.emplace_component<double>(entity, 1.0);
+        }
+        if (nodec::entities::to_entity(entity) % 10 == 0) {
+            registry.emplace_component<char>(entity);
+        }
+    }
+
+    SUBCASE("visits each entity exactly once") {
+        std::atomic<int> count{0};
+
+        registry.view<int>().each_parallel(
+            executor, [&](auto, int &value) {
+                ++value;
+                ++count;
+            },
+            64);
+
+        CHECK(count == 1000);
+        for (const auto entity : entities) {
+            CHECK(registry.get_component<int>(entity) == 1);
+        }
+    }
+
+    SUBCASE("with other pools and exclusions") {
+        std::atomic<int> count{0};
+
+        registry.view<int, double>(nodec::type_list<char>{}).each_parallel(
+            executor, [&](auto entity, int &value, double &) {
+                CHECK(nodec::entities::to_entity(entity) % 2 == 0);
+                CHECK(nodec::entities::to_entity(entity) % 10 != 0);
+                ++value;
+                ++count;
+            },
+            7);
+
+        CHECK(count == 400);
+    }
+
+    SUBCASE("the range smaller than the grain runs on the calling thread") {
+        const auto caller = std::this_thread::get_id();
+        registry.view<int>().each_parallel(executor, [&](auto, int &) {
+            CHECK(std::this_thread::get_id() == caller);
+        });
+    }
+
+    SUBCASE("rethrows the exception after joining") {
+        std::atomic<int> count{0};
+
+        CHECK_THROWS_AS(
+            registry.view<int>().each_parallel(
+                executor, [&](auto entity, int &) {
+                    ++count;
+                    if (entity == entities[500]) throw std::runtime_error("error");
+                },
+                100),
+            std::runtime_error);
+
+        CHECK(count == 1000);
+    }
+}
+
+namespace {
+
+struct Visible {};
+
+} // namespace
+
+TEST_CASE("Testing views with empty types.") {
+    using namespace nodec::entities;
+
+    Registry registry;
+
+    std::vector<Entity> entities(10);
+    registry.create_entities(entities.begin(), entities.end());
+    registry.insert_components(entities.begin(), entities.end(), 1);
+    registry.insert_components(entities.begin(), entities.begin() + 4, Visible{});
+
+    int count = 0;
+    registry.view<int, Visible>().each([&](auto, int &value, Visible) {
+        value += 1;
+        ++count;
+    });
+    CHECK(count == 4);
+    CHECK(registry.get_component<int>(entities[0]) == 2);
+    CHECK(registry.get_component<int>(entities[4]) == 1);
+
+    auto [value, tag] = registry.view<int, Visible>().get(entities[0]);
+    CHECK(value == 2);
+    (void)tag;
+
+    CHECK(registry.all_of<Visible>(entities[3]));
+    CHECK(registry.remove_component<Visible>(entities[3]));
+    CHECK(!registry.all_of<Visible>(entities[3]));
+}
+
+TEST_CASE("Testing runtime_view.") {
+    using namespace nodec;
+    using namespace nodec::entities;
+
+    Registry registry;
+
+    std::vector<Entity> entities(10);
+    registry.create_entities(entities.begin(), entities.end());
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+        registry.emplace_component<int>(entities[i], static_cast<int>(i));
+        if (i % 2 == 0) registry.emplace_component<double>(entities[i], 0.5);
+        if (i % 4 == 0) registry.emplace_component<char>(entities[i], 'a');
+    }
+
+    const std::vector<type_info> includes{type_id<double>(), type_id<int>()};
+    const std::vector<type_info> excludes{type_id<char>()};
+
+    auto view = registry.runtime_view(includes, excludes);
+    CHECK(view.size_hint() == 5);
+    CHECK(view.contains(entities[2]));
+    CHECK(!view.contains(entities[4]));
+    CHECK(!view.contains(entities[1]));
+
+    int count = 0;
+    view.each([&](auto entity, ArrayView<void *> components) {
+        CHECK(components.size() == 2);
+        CHECK(*static_cast<double *>(components[0]) == 0.5);
+        CHECK(static_cast<int *>(components[1]) == &registry.get_component<int>(entity));
+        *static_cast<int *>(components[1]) += 100;
+        ++count;
+    });
+    CHECK(count == 2);
+    CHECK(registry.get_component<int>(entities[2]) == 102);
+    CHECK(registry.get_component<int>(entities[0]) == 0);
+
+    std::vector<Entity> visited;
+    view.each_entity([&](auto entity) { visited.push_back(entity); });
+    CHECK(visited.size() == 2);
+
+    SUBCASE("the components without pools") {
+        struct Unused {};
+
+        const std::vector<type_info> with_unused{type_id<int>(), type_id<Unused>()};
+        CHECK(registry.runtime_view(with_unused).size_hint() == 0);
+
+        const std::vector<type_info> only_int{type_id<int>()};
+        const std::vector<type_info> without_unused{type_id<Unused>()};
+        count = 0;
+        registry.runtime_view(only_int, without_unused).each([&](auto, auto) { ++count; });
+        CHECK(count == 10);
+    }
+}
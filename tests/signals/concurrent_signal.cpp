@@ -0,0 +1,243 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include <nodec/signals/concurrent_signal.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+using namespace nodec::signals;
+
+namespace {
+
+int global_value = 0;
+
+void set_global_value(int value) {
+    global_value = value;
+}
+
+struct Receiver {
+    void on_value(int value) {
+        sum += value;
+    }
+
+    int sum{0};
+};
+
+} // namespace
+
+TEST_CASE("testing emit.") {
+    ConcurrentSignal<void(int)> signal;
+
+    int sum = 0;
+    signal.signal_interface().connect([&](int value) { sum += value; });
+    signal.signal_interface().connect([&](int value) { sum += value * 10; });
+
+    signal(1);
+    CHECK(sum == 11);
+}
+
+TEST_CASE("testing bound functions.") {
+    ConcurrentSignal<void(int)> signal;
+
+    Receiver receiver;
+    signal.signal_interface().connect<&set_global_value>();
+    signal.signal_interface().connect<&Receiver::on_value>(receiver);
+
+    signal(7);
+    CHECK(global_value == 7);
+    CHECK(receiver.sum == 7);
+}
+
+TEST_CASE("testing block and disconnect.") {
+    ConcurrentSignal<void()> signal;
+
+    int count = 0;
+    Connection conn = signal.signal_interface().connect([&]() { ++count; });
+
+    conn.block();
+    signal();
+    CHECK(count == 0);
+
+    conn.unblock();
+    signal();
+    CHECK(count == 1);
+
+    conn.disconnect();
+    signal();
+    CHECK(count == 1);
+
+    {
+        Connection scoped = signal.signal_interface().connect([&]() { ++count; });
+        signal();
+        CHECK(count == 2);
+    }
+    signal();
+    CHECK(count == 2);
+}
+
+TEST_CASE("testing connect and disconnect in a callback.") {
+    ConcurrentSignal<void()> signal;
+
+    int self_count = 0;
+    int added_count = 0;
+    std::optional<Connection> self;
+    std::vector<Connection> added;
+
+    self = signal.signal_interface().connect([&]() {
+        ++self_count;
+        added.emplace_back(signal.signal_interface().connect([&]() { ++added_count; }));
+        self->disconnect();
+    });
+
+    // The changes take effect from the next emission.
+    signal();
+    CHECK(self_count == 1);
+    CHECK(added_count == 0);
+
+    signal();
+    CHECK(self_count == 1);
+    CHECK(added_count == 1);
+}
+
+TEST_CASE("testing the signal destroyed before the connection.") {
+    int count = 0;
+    Connection conn;
+    {
+        ConcurrentSignal<void()> signal;
+        conn = signal.signal_interface().connect([&]() { ++count; });
+        signal.signal_interface().connect([&]() { ++count; });
+        signal();
+        CHECK(count == 2);
+    }
+    conn.block();
+    conn.disconnect();
+}
+
+TEST_CASE("testing move.") {
+    ConcurrentSignal<void()> signal;
+
+    int count = 0;
+    Connection conn = signal.signal_interface().connect([&]() { ++count; });
+
+    ConcurrentSignal<void()> moved(std::move(signal));
+    moved();
+    CHECK(count == 1);
+
+    conn.disconnect();
+    moved();
+    CHECK(count == 1);
+}
+
+TEST_CASE("testing emit from threads while connecting and disconnecting.") {
+    ConcurrentSignal<void(int)> signal;
+
+    std::atomic<long long> stable_sum{0};
+    Connection stable = signal.signal_interface().connect([&](int value) {
+        stable_sum.fetch_add(value, std::memory_order_relaxed);
+    });
+
+    constexpr int emitter_count = 4;
+    constexpr int emit_count = 20000;
+
+    std::atomic<bool> running{true};
+    std::atomic<long long> transient_sum{0};
+    std::thread changer([&]() {
+        while (running.load()) {
+            Connection conn = signal.signal_interface().connect([&](int value) {
+                transient_sum.fetch_add(value, std::memory_order_relaxed);
+            });
+            conn.block();
+            conn.unblock();
+        }
+    });
+
+    std::vector<std::thread> emitters;
+    for (int i = 0; i < emitter_count; ++i) {
+        emitters.emplace_back([&]() {
+            for (int j = 0; j < emit_count; ++j) {
+                signal(1);
+            }
+        });
+    }
+    for (auto &emitter : emitters) emitter.join();
+
+    running.store(false);
+    changer.join();
+
+    // The slot connected all the time sees every emission.
+    CHECK(stable_sum.load() == emitter_count * emit_count);
+    CHECK(transient_sum.load() <= emitter_count * emit_count);
+}
+
+TEST_CASE("testing the callback is not running once disconnected.") {
+    ConcurrentSignal<void()> signal;
+
+    std::atomic<bool> running{true};
+    std::atomic<bool> entered{false};
+    std::atomic<bool> inside{false};
+    std::atomic<bool> disconnected{false};
+    std::atomic<bool> called_after{false};
+
+    Connection conn = signal.signal_interface().connect([&]() {
+        inside.store(true);
+        entered.store(true);
+        if (disconnected.load()) called_after.store(true);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        inside.store(false);
+    });
+
+    std::thread emitter([&]() {
+        while (running.load()) signal();
+    });
+
+    while (!entered.load()) std::this_thread::yield();
+    conn.disconnect();
+    disconnected.store(true);
+    const bool inside_after = inside.load();
+
+    running.store(false);
+    emitter.join();
+
+    CHECK(!inside_after);
+    CHECK(!called_after.load());
+}
+
+TEST_CASE("testing the retired lists are freed under steady emission.") {
+    using State = details::ConcurrentSignalState<void(int)>;
+    auto state = std::make_shared<State>();
+
+    std::atomic<long long> sum{0};
+    std::unique_ptr<State::ConnectionImpl> stable{state->connect(state, [&](int value) {
+        sum.fetch_add(value, std::memory_order_relaxed);
+    })};
+
+    std::atomic<bool> running{true};
+    std::vector<std::thread> emitters;
+    for (int i = 0; i < 4; ++i) {
+        emitters.emplace_back([&]() {
+            while (running.load(std::memory_order_relaxed)) state->emit(1);
+        });
+    }
+
+    // The changes run while the emitters are inside the signal.
+    while (sum.load() == 0) std::this_thread::yield();
+
+    std::size_t max_retired = 0;
+    for (int i = 0; i < 1000; ++i) {
+        std::unique_ptr<State::ConnectionImpl> conn{state->connect(state, [](int) {})};
+        max_retired = (std::max)(max_retired, state->retired_size());
+        conn.reset();
+        max_retired = (std::max)(max_retired, state->retired_size());
+    }
+
+    running.store(false);
+    for (auto &emitter : emitters) emitter.join();
+
+    CHECK(max_retired == 0);
+}
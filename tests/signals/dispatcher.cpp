@@ -0,0 +1,136 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include <nodec/signals/dispatcher.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace nodec;
+using namespace nodec::signals;
+
+namespace {
+
+struct Collision {
+    int a;
+    int b;
+};
+
+struct Damage {
+    Damage(std::string target, int amount)
+        : target(std::move(target)), amount(amount) {}
+
+    std::string target;
+    int amount;
+};
+
+} // namespace
+
+TEST_CASE("testing enqueue and update.") {
+    Dispatcher dispatcher;
+
+    int batch_count = 0;
+    std::vector<int> sums;
+    Connection conn = dispatcher.events<Collision>().connect([&](ArrayView<const Collision> collisions) {
+        ++batch_count;
+        for (const auto &collision : collisions) {
+            sums.push_back(collision.a + collision.b);
+        }
+    });
+
+    dispatcher.enqueue<Collision>(1, 2);
+    dispatcher.enqueue<Collision>(3, 4);
+    dispatcher.enqueue(Collision{5, 6});
+    CHECK(dispatcher.size<Collision>() == 3);
+    CHECK(batch_count == 0);
+
+    dispatcher.update();
+    CHECK(batch_count == 1);
+    CHECK(sums == std::vector<int>{3, 7, 11});
+    CHECK(dispatcher.size() == 0);
+
+    // Nothing queued, no call.
+    dispatcher.update();
+    CHECK(batch_count == 1);
+}
+
+TEST_CASE("testing the queues per event type.") {
+    Dispatcher dispatcher;
+
+    int collision_count = 0;
+    int damage_total = 0;
+    Connection collision_conn = dispatcher.events<Collision>().connect([&](ArrayView<const Collision> collisions) {
+        collision_count += static_cast<int>(collisions.size());
+    });
+    Connection damage_conn = dispatcher.events<Damage>().connect([&](ArrayView<const Damage> damages) {
+        for (const auto &damage : damages) damage_total += damage.amount;
+    });
+
+    dispatcher.enqueue<Collision>(1, 2);
+    dispatcher.enqueue<Damage>("enemy", 10);
+    dispatcher.enqueue<Damage>("player", 5);
+    CHECK(dispatcher.size() == 3);
+
+    dispatcher.update<Damage>();
+    CHECK(damage_total == 15);
+    CHECK(collision_count == 0);
+    CHECK(dispatcher.size<Collision>() == 1);
+
+    dispatcher.clear<Collision>();
+    dispatcher.update();
+    CHECK(collision_count == 0);
+
+    dispatcher.trigger(Collision{1, 1});
+    CHECK(collision_count == 1);
+}
+
+TEST_CASE("testing enqueue in a listener.") {
+    Dispatcher dispatcher;
+
+    std::vector<int> received;
+    Connection conn = dispatcher.events<Collision>().connect([&](ArrayView<const Collision> collisions) {
+        for (const auto &collision : collisions) {
+            received.push_back(collision.a);
+            if (collision.a < 3) dispatcher.enqueue<Collision>(collision.a + 1, 0);
+        }
+        // The batch in use is not published again.
+        dispatcher.update();
+    });
+
+    dispatcher.enqueue<Collision>(1, 0);
+
+    // Each update drains the queue once.
+    dispatcher.update();
+    CHECK(received == std::vector<int>{1});
+    dispatcher.update();
+    CHECK(received == std::vector<int>{1, 2});
+    dispatcher.update();
+    CHECK(received == std::vector<int>{1, 2, 3});
+    CHECK(dispatcher.size() == 0);
+}
+
+TEST_CASE("testing schedule update on the event loop.") {
+    asyncio::EventLoop event_loop;
+    Dispatcher dispatcher;
+
+    int batch_count = 0;
+    std::size_t event_count = 0;
+    Connection conn = dispatcher.events<Collision>().connect([&](ArrayView<const Collision> collisions) {
+        ++batch_count;
+        event_count += collisions.size();
+    });
+
+    for (int i = 0; i < 10; ++i) {
+        dispatcher.enqueue<Collision>(i, i);
+        dispatcher.schedule_update(event_loop);
+    }
+    CHECK(dispatcher.update_scheduled());
+    CHECK(batch_count == 0);
+
+    CHECK(event_loop.spin_once() == 1);
+    CHECK(batch_count == 1);
+    CHECK(event_count == 10);
+    CHECK(!dispatcher.update_scheduled());
+
+    CHECK(event_loop.spin_once() == 0);
+}
@@ -4,6 +4,9 @@
 #include <nodec/signals/scoped_block.hpp>
 #include <nodec/signals/signal.hpp>
 
+#include <stdexcept>
+#include <vector>
+
 namespace global_func_test {
 
 int global_count = 0;
@@ -130,6 +133,93 @@ TEST_CASE("testing the assignment of connection.") {
     conn = signal.signal_interface().connect([&]() {});
 }
 
+namespace member_func_test {
+
+struct Receiver {
+    void on_value(int value) {
+        sum += value;
+    }
+
+    int sum{0};
+};
+
+int global_sum = 0;
+
+void on_value(int value) {
+    global_sum += value;
+}
+
+TEST_CASE("testing connect bound functions.") {
+    using namespace nodec::signals;
+
+    Signal<void(int)> signal;
+    Receiver receiver;
+
+    Connection member = signal.signal_interface().connect<&Receiver::on_value>(receiver);
+    Connection free = signal.signal_interface().connect<&on_value>();
+
+    signal(3);
+    CHECK(receiver.sum == 3);
+    CHECK(global_sum == 3);
+
+    member.disconnect();
+    signal(4);
+    CHECK(receiver.sum == 3);
+    CHECK(global_sum == 7);
+}
+
+} // namespace member_func_test
+
+TEST_CASE("testing connect and disconnect in the callback.") {
+    using namespace nodec::signals;
+
+    Signal<void()> signal;
+
+    int outer = 0;
+    int inner = 0;
+    std::vector<Connection> connections;
+
+    Connection conn = signal.signal_interface().connect([&]() {
+        ++outer;
+        // Connecting many slots while this callback runs must not move it.
+        for (int i = 0; i < 16; ++i) {
+            connections.emplace_back(signal.signal_interface().connect([&]() { ++inner; }));
+        }
+        conn.disconnect();
+        ++outer;
+    });
+
+    signal();
+    CHECK(outer == 2);
+    CHECK(inner == 0);
+
+    signal();
+    CHECK(outer == 2);
+    CHECK(inner == 16);
+
+    connections.clear();
+    signal();
+    CHECK(inner == 16);
+}
+
+TEST_CASE("testing the signal after a callback throws.") {
+    using namespace nodec::signals;
+
+    Signal<void()> signal;
+
+    int count = 0;
+    Connection throwing = signal.signal_interface().connect([&]() {
+        signal.signal_interface().connect([&]() { ++count; });
+        throw std::runtime_error("error");
+    });
+
+    CHECK_THROWS_AS(signal(), std::runtime_error);
+    throwing.disconnect();
+
+    signal();
+    CHECK(count == 1);
+}
+
 // using namespace nodec;
 
 // // A function callback